@@ -0,0 +1,27 @@
+module Barrel_Shifter #(
+    parameter WIDTH = 32,
+    parameter SHIFT_W = $clog2(WIDTH)
+) (
+    input  [WIDTH-1:0]      data_in,
+    input  [SHIFT_W-1:0]    shift_amt,
+    input                   shift_right,    // 0: toward the MSB, 1: toward the LSB (zero fill)
+    output [WIDTH-1:0]      data_out
+);
+    // One mux level per shift_amt bit, level k moves the data by 2^k.
+    genvar k;
+    generate
+        for (k = 0; k <= SHIFT_W; k++) begin : stage
+            wire [WIDTH-1:0] data;
+            if (k == 0) begin : first
+                assign data = data_in;
+            end else begin : shift
+                wire [WIDTH-1:0] prev = stage[k-1].data;
+                assign data = !shift_amt[k-1] ? prev
+                            : shift_right     ? (prev >> (1 << (k-1)))
+                            :                   (prev << (1 << (k-1)));
+            end
+        end
+    endgenerate
+
+    assign data_out = stage[SHIFT_W].data;
+endmodule
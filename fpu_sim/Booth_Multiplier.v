@@ -0,0 +1,148 @@
+module Booth_Multiplier #(
+    parameter WIDTH = 24,
+    parameter STAGES = 0,               // Pipeline registers (0-3), spread over the reduction tree
+    parameter LOW_BITS = 21,            // Low product bits that are only needed as a sticky bit (0: full product)
+    parameter SIDE_W = 1                // Sideband bits delayed alongside the product
+) (
+    input clk,
+    input hold,                         // Keep every pipeline register (result not taken)
+    input  [WIDTH-1:0]              mant_a,
+    input  [WIDTH-1:0]              mant_b,
+    input  [SIDE_W-1:0]             side_in,
+    output [2*WIDTH-1:LOW_BITS]     product_hi,
+    output                          sticky,     // |product[LOW_BITS-1:0] for non-zero operands
+    output [SIDE_W-1:0]             side_out
+);
+    // Unsigned mant_a * mant_b: radix-4 Booth partial products of the zero-extended multiplier,
+    // reduced by levels of 3:2 carry-save adders down to two rows, then one carry-propagate add.
+    // All rows are full product width, so sign extension is simply mod 2^PW.
+    localparam PW = 2 * WIDTH;
+    localparam PP = (WIDTH + 2) / 2;    // Booth digits, the top one is never negative
+    localparam ROWS = PP + 1;           // partial products + one row of negate bits
+    localparam TZ_W = $clog2(WIDTH + 1);
+
+    // rows left after `level` 3:2 levels
+    function automatic integer rows_at(input integer level);
+        integer n;
+        n = ROWS;
+        for (int i = 0; i < level; i++) n = 2 * (n / 3) + n % 3;
+        rows_at = n;
+    endfunction
+
+    function automatic integer num_levels();
+        integer n;
+        n = 0;
+        while (rows_at(n) > 2) n++;
+        num_levels = n;
+    endfunction
+
+    localparam LEVELS = num_levels();
+
+    // steps: 0 = partial products, 1..LEVELS = reduction levels, LEVELS+1 = final add;
+    // the STAGES registers split the LEVELS+2 steps as evenly as possible
+    function automatic bit reg_after(input integer step);
+        reg_after = 1'b0;
+        for (int k = 1; k <= STAGES; k++) begin
+            if ((k * (LEVELS + 2)) / (STAGES + 1) - 1 == step) reg_after = 1'b1;
+        end
+    endfunction
+
+    wire [WIDTH+2:0] b_ext = {2'b00, mant_b, 1'b0};
+
+    genvar l, r, g, k;
+    generate
+        for (l = 0; l <= LEVELS; l++) begin : level
+            localparam N = rows_at(l);
+            wire [PW-1:0] row [0:N-1];
+            reg  [PW-1:0] row_q [0:N-1];    // row after the optional pipeline register
+
+            if (l == 0) begin : booth
+                wire [PP-1:0] neg;
+                reg [PW-1:0] neg_row;
+
+                for (r = 0; r < PP; r++) begin : digit
+                    wire [2:0] trip = b_ext[2*r +: 3];
+                    wire one = trip[1] ^ trip[0];
+                    wire two = (trip == 3'b100) || (trip == 3'b011);
+                    wire [PW-1:0] mag = one ? PW'(mant_a) : two ? (PW'(mant_a) << 1) : '0;
+                    assign neg[r] = trip[2] & ~(trip[1] & trip[0]);
+                    // -x = ~x + 1, the +1 goes into the negate row at the digit position
+                    assign row[r] = (neg[r] ? ~mag : mag) << (2 * r);
+                end
+
+                always @(*) begin
+                    neg_row = '0;
+                    for (int i = 0; i < PP; i++) neg_row[2*i] = neg[i];
+                end
+                assign row[PP] = neg_row;
+            end else begin : csa
+                localparam M = rows_at(l - 1);
+                for (g = 0; g < M / 3; g++) begin : group
+                    wire [PW-1:0] x = level[l-1].row_q[3*g];
+                    wire [PW-1:0] y = level[l-1].row_q[3*g+1];
+                    wire [PW-1:0] z = level[l-1].row_q[3*g+2];
+                    assign row[2*g]   = x ^ y ^ z;
+                    assign row[2*g+1] = ((x & y) | (x & z) | (y & z)) << 1;
+                end
+                for (g = 0; g < M % 3; g++) begin : pass
+                    assign row[2*(M/3)+g] = level[l-1].row_q[3*(M/3)+g];
+                end
+            end
+
+            if (reg_after(l)) begin : stage
+                always @(posedge clk) begin
+                    if (!hold) for (int i = 0; i < N; i++) row_q[i] <= row[i];
+                end
+            end else begin : wire_through
+                always @(*) begin
+                    for (int i = 0; i < N; i++) row_q[i] = row[i];
+                end
+            end
+        end
+    endgenerate
+
+    // --- Final Add ---
+    // Only the carry out of the low bits is formed, their sum bits are never needed.
+    wire [PW-1:0] sum_row = level[LEVELS].row_q[0];
+    wire [PW-1:0] carry_row = level[LEVELS].row_q[1];
+    wire low_carry;
+
+    generate
+        if (LOW_BITS > 0) begin : low
+            wire [LOW_BITS:0] low_add = {1'b0, sum_row[LOW_BITS-1:0]} + {1'b0, carry_row[LOW_BITS-1:0]};
+            assign low_carry = low_add[LOW_BITS];
+        end else begin : full
+            assign low_carry = 1'b0;
+        end
+    endgenerate
+
+    assign product_hi = sum_row[PW-1:LOW_BITS] + carry_row[PW-1:LOW_BITS] + (PW-LOW_BITS)'(low_carry);
+
+    // --- Sticky ---
+    // The low bits of a non-zero product are all zero exactly when the operands' trailing zeros
+    // add up to LOW_BITS, so sticky comes from the inputs instead of the product.
+    wire [WIDTH-1:0] a_rev = {<<{mant_a}};
+    wire [WIDTH-1:0] b_rev = {<<{mant_b}};
+    wire [TZ_W-1:0] tz_a, tz_b;
+
+    LZC #(.WIDTH(WIDTH)) tzc_a ( .data_in(a_rev), .count(tz_a) );
+    LZC #(.WIDTH(WIDTH)) tzc_b ( .data_in(b_rev), .count(tz_b) );
+
+    wire sticky_in = ({1'b0, tz_a} + {1'b0, tz_b}) < (TZ_W+1)'(LOW_BITS);
+
+    // --- Sideband ---
+    generate
+        for (k = 0; k <= STAGES; k++) begin : side_pipe
+            reg [SIDE_W:0] data;
+            if (k == 0) begin : first
+                always @(*) data = {sticky_in, side_in};
+            end else begin : stage
+                always @(posedge clk) begin
+                    if (!hold) data <= side_pipe[k-1].data;
+                end
+            end
+        end
+    endgenerate
+
+    assign {sticky, side_out} = side_pipe[STAGES].data;
+endmodule
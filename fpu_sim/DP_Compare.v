@@ -1,9 +1,13 @@
-module DP_Compare (
+module DP_Compare #(
+    parameter DENORMALS = 1     // 0: denormal operands always compare as zero
+) (
     input [63:0]    operand_a,
     input [63:0]    operand_b,
     input [2:0]     func3,
+    input           ftz,            // A denormal operand compares as a zero of its sign
     output reg      flag_cmp,
-    output reg      flag_invalid
+    output reg      flag_invalid,
+    output reg [9:0] cov                // Corner paths this op took, bin n on bit n (fpu_cov.h)
 );
     // operand a
     reg sign_a_dec;
@@ -18,39 +22,49 @@ module DP_Compare (
     reg is_b_zero, is_b_infinity, is_b_nan, is_b_denormal;
 
     // Decode / Encode
-    DP_Decoder decoder_a ( .fp_in(operand_a), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
-    DP_Decoder decoder_b ( .fp_in(operand_b), .sign_out(sign_b_dec), .exponent_out(exp_b_dec), .mantissa_out(mant_b_dec), .is_zero(is_b_zero), .is_infinity(is_b_infinity), .is_nan(is_b_nan), .is_denormal(is_b_denormal) );
+    DP_Decoder decoder_a ( .fp_in(operand_a), .daz(ftz || !DENORMALS), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    DP_Decoder decoder_b ( .fp_in(operand_b), .daz(ftz || !DENORMALS), .sign_out(sign_b_dec), .exponent_out(exp_b_dec), .mantissa_out(mant_b_dec), .is_zero(is_b_zero), .is_infinity(is_b_infinity), .is_nan(is_b_nan), .is_denormal(is_b_denormal) );
 
     // Local params
     localparam CMP_EQ = 3'b010;
     localparam CMP_LT = 3'b001;
     localparam CMP_LE = 3'b000;
 
+    // Coverage bins
+    localparam CV_NAN = 0, CV_SNAN = 1, CV_BOTH_ZERO = 2, CV_SIGN_DIFFERS = 3, CV_BOTH_NEGATIVE = 4, CV_EQUAL = 5;
+    localparam CV_DENORM_IN = 6, CV_EQ_TRUE = 7, CV_LT_TRUE = 8, CV_LE_TRUE = 9;
+
     // Local variables
-    reg is_a_snan = is_a_nan & !mant_a_dec[51];
-    reg is_b_snan = is_b_nan & !mant_b_dec[51];
+    wire is_a_snan = is_a_nan & !mant_a_dec[51];
+    wire is_b_snan = is_b_nan & !mant_b_dec[51];
     reg temp_eq, temp_gt, temp_lt, flag_eq, flag_gt, flag_lt, flag_unordered;
 
     always @(*) begin
         // init
         flag_cmp = 0;
         temp_eq=0; temp_gt=0; temp_lt=0; flag_eq=0; flag_gt=0; flag_lt=0; flag_unordered=0;
+        cov = '0;
 
         // Invalid flag is set for SNaN in comparison
         flag_invalid = is_a_snan | is_b_snan;
+        cov[CV_SNAN] = flag_invalid;
+        cov[CV_DENORM_IN] = is_a_denormal | is_b_denormal;
 
         // --- Comparison Logic ---
         // Path 1: At least one operand is NaN
         if (is_a_nan || is_b_nan) begin
             flag_unordered = 1'b1;
+            cov[CV_NAN] = 1;
         end
         // Path 2: Both operands are Zero (+0 or -0)
         else if (is_a_zero && is_b_zero) begin
             // Per IEEE 754, +0 and -0 are equal in comparisons
             flag_eq = 1'b1;
+            cov[CV_BOTH_ZERO] = 1;
         end
         // Path 3: Operands have different signs (and are not both zero)
         else if (sign_a_dec != sign_b_dec) begin
+            cov[CV_SIGN_DIFFERS] = 1;
             if (sign_a_dec) begin // A is negative, B is positive
                 flag_lt = 1'b1; 
             end else begin // A is positive, B is negative
@@ -60,10 +74,13 @@ module DP_Compare (
         // Path 4: Operands have the same sign (and are not NaN or Zero)
         else begin 
             // Compare as if they were unsigned integers (sign bit is the same)
-            // The decoded format (exp, mant) allows for direct magnitude comparison.
-            temp_gt = ({exp_a_dec, mant_a_dec} > {exp_b_dec, mant_b_dec});
-            temp_lt = ({exp_a_dec, mant_a_dec} < {exp_b_dec, mant_b_dec});
-            temp_eq = ({exp_a_dec, mant_a_dec} == {exp_b_dec, mant_b_dec});
+            // The encoded magnitude orders directly; the decoded mantissa does not, since a
+            // zero decodes with its hidden bit set.
+            temp_gt = (operand_a[62:0] > operand_b[62:0]);
+            temp_lt = (operand_a[62:0] < operand_b[62:0]);
+            temp_eq = (operand_a[62:0] == operand_b[62:0]);
+            cov[CV_EQUAL] = temp_eq;
+            cov[CV_BOTH_NEGATIVE] = sign_a_dec;
 
             // If both numbers are negative, the sense of the comparison is inverted.
             // A larger magnitude negative number is "less than".
@@ -84,5 +101,8 @@ module DP_Compare (
             CMP_LE: flag_cmp = (flag_unordered) ? 0 : flag_eq | flag_lt;
             default: flag_cmp = 0; 
         endcase
+        cov[CV_EQ_TRUE] = flag_cmp && func3 == CMP_EQ;
+        cov[CV_LT_TRUE] = flag_cmp && func3 == CMP_LT;
+        cov[CV_LE_TRUE] = flag_cmp && func3 == CMP_LE;
     end
 endmodule
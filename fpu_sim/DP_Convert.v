@@ -1,13 +1,17 @@
-module DP_Convert (
+module DP_Convert #(
+    parameter DENORMALS = 1     // 0: FTZ / DAZ on every op, no denormal SP shift
+) (
     input [63:0]    operand_in,
     input [1:0]     input_type,
     input [1:0]     output_type,
     input [2:0]     rounding_mode,
+    input           ftz,            // Denormal FP64 input reads as zero, tiny FP32 result flushes to zero
     output reg [31:0]   result,
     output reg      flag_invalid,
     output reg      flag_overflow,
     output reg      flag_underflow,
-    output reg      flag_inexact
+    output reg      flag_inexact,
+    output reg [18:0]   cov             // Corner paths this op took, bin n on bit n (fpu_cov.h)
 );
     // --- Type & Constant Definitions ---
     localparam FP_TYPE_FP32 = 2'b00, FP_TYPE_FP64 = 2'b01;
@@ -25,6 +29,25 @@ module DP_Convert (
     localparam RUP = 3'b011;
     localparam RMM = 3'b100;
 
+    // --- Coverage bins ---
+    localparam CV_NAN = 0, CV_INF = 1, CV_ZERO = 2, CV_INT_NEGATIVE = 3;
+    localparam CV_DENORM_OUT = 4, CV_UNDERFLOW_ZERO = 5, CV_NEAR_MAX = 6, CV_OVERFLOW = 7;
+    localparam CV_UINT_NEGATIVE = 8, CV_FRAC = 9, CV_FRAC_ROUNDED = 10, CV_INT_OVERFLOW = 11, CV_INT_MIN = 12;
+    localparam CV_RNE_UP = 13;          // RNE, RDN, RUP, RMM rounded up: 13..16
+    localparam CV_ROUND_CARRY = 17, CV_ROUND_OVERFLOW = 18;
+
+    // round-up decision shared by the normal-precision tininess check and the final rounding
+    function automatic round_inc(input [2:0] mode, input sign, input lsb, input g, input r, input s);
+        case (mode)
+            3'b000: round_inc = g & (lsb | r | s); // RNE
+            3'b001: round_inc = 1'b0; // RTZ
+            3'b010: round_inc = (g | r | s) & sign; // RDN
+            3'b011: round_inc = (g | r | s) & ~sign; // RUP
+            3'b100: round_inc = g; // RMM
+            default: round_inc = 1'b0;
+        endcase
+    endfunction
+
     // operand a
     reg sign_a_dec;
     reg [10:0] exp_a_dec;
@@ -41,15 +64,27 @@ module DP_Convert (
     reg [31:0] result_int_32;
     
     // Decode / Encode
-    DP_Decoder decoder_a ( .fp_in(operand_in), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    wire flush = ftz || !DENORMALS;
+    DP_Decoder decoder_a ( .fp_in(operand_in), .daz(flush), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
     SP_Encoder encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result_sp) );
 
+    // --- Normalization (denormal SP output, INT input) ---
+    wire [31:0] int_abs = ((input_type == FP_TYPE_INT32) && operand_in[31]) ? -operand_in[31:0] : operand_in[31:0];
+    wire [5:0] lz_int;
+    wire [31:0] int_norm;
+
+    LZC #(.WIDTH(32)) lzc_int ( .data_in(int_abs), .count(lz_int) );
+    Barrel_Shifter #(.WIDTH(32), .SHIFT_W(6)) norm_int ( .data_in(int_abs), .shift_amt(lz_int), .shift_right(1'b0), .data_out(int_norm) );
+
     reg normal_path_enable;
-    reg [10:0] exp_a_sp;
-    reg [52:0] mant_a_sp;
-    reg [63:0] shifted_val;
-    reg lsb, g_bit, r_bit, s_bit, round_up;
-    int shift_amt;
+    reg lsb, g_bit, r_bit, s_bit, round_up, tiny;
+    int exp_sp;
+    reg [26:0] sp_norm;                 // result mantissa [26:3], guard 2, round 1, sticky 0
+    reg [24:0] sp_mant;
+    int int_exp;
+    reg [95:0] int_fixed;
+    reg [32:0] int_mag;
+    reg int_inexact;
 
     always @(*) begin
 
@@ -58,12 +93,12 @@ module DP_Convert (
         normal_path_enable = 1;
 
         final_sign=0; final_exp='0; final_mant='0;
-        exp_a_sp = '0; mant_a_sp = '0;
-        shifted_val = '0;
         result_int = '0;
         result_int_32 = '0;
-        lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0;
-        shift_amt = 0;
+        lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0; tiny = 0;
+        exp_sp = 0; sp_norm = '0; sp_mant = '0;
+        int_exp = 0; int_fixed = '0; int_mag = '0; int_inexact = 0;
+        cov = '0;
 
         // --- 1. Special Value Handling ---
         if (input_type == FP_TYPE_FP64) begin
@@ -71,6 +106,7 @@ module DP_Convert (
 
                 normal_path_enable = 0;
                 flag_invalid = 1; // NV
+                cov[CV_NAN] = 1;
                 if (output_type == FP_TYPE_INT32) begin result_int_32 = INT32_MIN_VAL; end // int32
                 else if (output_type == FP_TYPE_UINT32) begin result_int_32 = UINT32_MAX_VAL; end // uint32
                 else begin final_sign = 0; final_exp = '1; final_mant = FP32_QNAN_MANT; end // float (NaN)
@@ -78,6 +114,7 @@ module DP_Convert (
             end else if (is_a_infinity) begin
 
                 normal_path_enable = 0;
+                cov[CV_INF] = 1;
                 if (output_type == FP_TYPE_INT32) begin flag_invalid = 1; flag_overflow = 1; result_int_32 = (sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL; end // int32 (NV, OF)
                 else if (output_type == FP_TYPE_UINT32) begin flag_invalid = 1; flag_overflow = !sign_a_dec; result_int_32 = (sign_a_dec) ? UINT32_MIN_VAL : UINT32_MAX_VAL; end // uint32 (NV, OF(+))
                 else begin final_sign = sign_a_dec; final_exp = '1; final_mant = '0; end // float (inf)
@@ -85,6 +122,7 @@ module DP_Convert (
             end else if (is_a_zero) begin
 
                 normal_path_enable = 0;
+                cov[CV_ZERO] = 1;
                 if (output_type == FP_TYPE_INT32 || output_type == FP_TYPE_UINT32) begin result_int_32 = '0; end // 0
                 else begin final_sign = sign_a_dec; final_exp = '0; final_mant = '0; end // 0
 
@@ -94,6 +132,7 @@ module DP_Convert (
 
             normal_path_enable = 0;
             final_sign = 0; final_exp = '0; final_mant = '0; // 0
+            cov[CV_ZERO] = 1;
 
         end
 
@@ -103,184 +142,118 @@ module DP_Convert (
             if ((input_type == FP_TYPE_FP64) && (output_type == FP_TYPE_FP32)) begin
                 // sign
                 final_sign = sign_a_dec;
-                
-                // exponent / mantissa
-                if (exp_a_dec <= 896 && exp_a_dec >= 874) begin
-                    final_exp = '0;
-                    mant_a_sp = mant_a_dec;
-                    for (int i = 897; i > exp_a_dec ; i--) begin
-                        mant_a_sp >>= 1;
-                    end
-                    final_mant = mant_a_sp[52:29];
-                    flag_inexact = |mant_a_sp[28:0];
-                    flag_underflow = (final_mant == 0);
-                end
-                else if (exp_a_dec == 1150) begin// (2^127)
-                    if((mant_a_dec[52:29] == {24{1'b1}}) && (mant_a_dec[28:0] != 0)) begin flag_invalid = 1; flag_overflow = 1; final_exp = '1; final_mant = '0; end // Inf
-                    else begin final_exp = 8'd254; final_mant = mant_a_dec[52:29]; end
-                end
-                else if (exp_a_dec > 1150) begin
-                    flag_invalid = 1; flag_overflow = 1;
-                    final_exp = '1; final_mant = '0; // Inf
-                end
-                else begin // in float range
-                    exp_a_sp = exp_a_dec - 11'd896;
-                    final_exp = exp_a_sp[7:0];
-                    
-                    mant_a_sp = mant_a_dec >> 1;
-                    lsb = mant_a_sp[28];
-                    g_bit = mant_a_sp[27];
-                    r_bit = mant_a_sp[26];
-                    s_bit = mant_a_sp[25];
-                    flag_inexact = g_bit | r_bit | s_bit;
-                    case (rounding_mode)
-                        3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                        3'b001: round_up = 1'b0; // RTZ
-                        3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                        3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                        3'b100: round_up = flag_inexact; //RMM
-                        default: round_up = 1'b0;
-                    endcase
-                    if(round_up) begin mant_a_sp += {25'b0, 1'b1, 27'b0}; end
-                    if(mant_a_sp[52]) begin final_exp += 1; mant_a_sp >>= 1; end
-
-                    final_mant = mant_a_sp[51:28];
-                end
-            end
 
-            // --- DP -> UINT Conversion ---
-            else if ((input_type == FP_TYPE_FP64) && (output_type == FP_TYPE_UINT32)) begin
-                if (sign_a_dec) begin // negative
-                    result_int_32 = '0;
-                    flag_invalid = 1;
-                end else if (exp_a_dec < 1023) begin // 0.xx
-                    result_int_32 = '0;
-                    flag_inexact = |mant_a_dec[52:0];
-                    if (flag_inexact && (rounding_mode == RUP)) begin
-                        result_int_32 = 32'd1;
-                    end
-                end else if (exp_a_dec > 1054) begin // over 2^32
-                    flag_invalid = 1;
-                    flag_overflow = 1;
-                    flag_inexact = 1;
-                    result_int_32 = UINT32_MAX_VAL;
-                end else begin
-                    shift_amt = 1075 - {21'b0, exp_a_dec}; // 1075 = 1023 + 52
-                    
-                    if (shift_amt >= 0) begin
-                        result_int = {11'b0, mant_a_dec} >> shift_amt;
-                        shifted_val = {11'b0, mant_a_dec} << (53 - shift_amt);
+                // exponent / mantissa, rounded once at SP precision
+                exp_sp = (is_a_denormal ? 1 : int'(exp_a_dec)) - 896;
+                sp_norm = {mant_a_dec[52:27], |mant_a_dec[26:0]};
+                cov[CV_NEAR_MAX] = (exp_sp == 254);
+
+                // tininess (after rounding, unbounded exponent)
+                tiny = (exp_sp < 1);
+                if (exp_sp == 0 && (&sp_norm[26:3])) tiny = !round_inc(rounding_mode, final_sign, sp_norm[3], sp_norm[2], sp_norm[1], sp_norm[0]);
+
+                // SP denormal (tiny results flush below instead)
+                if (exp_sp < 1 && !flush) begin
+                    cov[CV_DENORM_OUT] = 1;
+                    if (1 - exp_sp > 25) begin
+                        sp_norm = {26'b0, |sp_norm};
                     end else begin
-                        result_int = {11'b0, mant_a_dec} << -shift_amt;
-                        shifted_val = {11'b0, mant_a_dec} >> (shift_amt - 53);
+                        s_bit = |(sp_norm & ((27'(1) << (1 - exp_sp)) - 1));
+                        sp_norm = (sp_norm >> (1 - exp_sp)) | {26'b0, s_bit};
                     end
+                    exp_sp = 0;
+                end
 
-                    // rounding
-                    lsb = result_int[0];
-                    g_bit = shifted_val[52];
-                    r_bit = shifted_val[51];
-                    s_bit = |shifted_val[50:0];
-                    flag_inexact = g_bit | r_bit | s_bit;
-                    case (rounding_mode)
-                        3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                        3'b001: round_up = 1'b0; // RTZ
-                        3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                        3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                        3'b100: round_up = flag_inexact; //RMM
-                        default: round_up = 1'b0;
-                    endcase
-                    result_int += {63'b0, round_up};
-                    result_int_32 = result_int[31:0];
-
-                    if (result_int[63:32] != 0) begin
-                        flag_invalid=1; flag_inexact=1; result_int_32=UINT32_MAX_VAL;
+                // rounding
+                lsb = sp_norm[3]; g_bit = sp_norm[2]; r_bit = sp_norm[1]; s_bit = sp_norm[0];
+                flag_inexact = g_bit | r_bit | s_bit;
+                round_up = round_inc(rounding_mode, final_sign, lsb, g_bit, r_bit, s_bit);
+                sp_mant = {1'b0, sp_norm[26:3]} + {24'b0, round_up};
+                if (sp_mant[24]) begin sp_mant >>= 1; exp_sp += 1; cov[CV_ROUND_CARRY] = 1; end
+                if (exp_sp == 0 && sp_mant[23] && !flush) exp_sp = 1; // denormal rounded up to min normal
+
+                // OF / UF
+                if (exp_sp > 254) begin
+                    flag_overflow = 1; flag_inexact = 1;
+                    if (rounding_mode == RTZ || (rounding_mode == RDN && !final_sign) || (rounding_mode == RUP && final_sign)) begin
+                        final_exp = 8'd254; final_mant = '1; // max normal
+                    end else begin
+                        final_exp = '1; final_mant = '0; // Inf
                     end
+                    cov[CV_OVERFLOW] = 1;
+                end else if (flush && tiny) begin
+                    flag_underflow = 1; flag_inexact = 1;
+                    cov[CV_UNDERFLOW_ZERO] = 1;
+                    final_exp = '0; final_mant = '0; // zero of the input's sign
+                end else begin
+                    flag_underflow = tiny & flag_inexact;
+                    cov[CV_UNDERFLOW_ZERO] = (exp_sp == 0) && (sp_mant == 0);
+                    final_exp = exp_sp[7:0];
+                    final_mant = sp_mant[23:0];
                 end
             end
 
-            // --- DP -> INT Conversion ---
-            else if ((input_type == FP_TYPE_FP64) && (output_type == FP_TYPE_INT32)) begin
-                if (exp_a_dec < 1023) begin // 0.xx
-                    result_int_32 = '0;
-                    flag_inexact = |mant_a_dec[52:0];
-                    if (flag_inexact) begin
-                        if (!sign_a_dec && (rounding_mode == RUP)) begin result_int_32 = 32'd1; end // 1
-                        else if (sign_a_dec && (rounding_mode == RDN)) begin result_int_32 = -$signed(32'd1); end // -1
-                    end
-                end else if (exp_a_dec >= 1054) begin
-                    if (sign_a_dec && (exp_a_dec == 1054) && (mant_a_dec == {1'b1, 52'b0})) begin result_int_32 = INT32_MIN_VAL; end
-                    else begin
-                        flag_invalid = 1;
-                        flag_overflow = 1;
-                        flag_inexact = 1;
-                        result_int_32 = (sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL;
-                    end
+            // --- DP -> INT / UINT Conversion ---
+            else if ((input_type == FP_TYPE_FP64) && (output_type == FP_TYPE_INT32 || output_type == FP_TYPE_UINT32)) begin
+                // fixed point with the binary point at bit 64; 2^32 and up is out of range either way
+                int_exp = (is_a_denormal ? 1 : int'(exp_a_dec)) - 1023;
+                cov[CV_FRAC] = (int_exp < 0);
+                if (int_exp > 31) begin
+                    int_mag = 33'h1_0000_0000; int_inexact = 0;
+                    cov[CV_INT_OVERFLOW] = 1;
                 end else begin
-                    shift_amt = 1075 - {21'b0, exp_a_dec}; // 1075 = 1023 + 52
-                    
-                    if (shift_amt >= 0) begin
-                        result_int = {11'b0, mant_a_dec} >> shift_amt;
-                        shifted_val = {11'b0, mant_a_dec} << (53 - shift_amt);
+                    if (int_exp < -2) int_fixed = 96'd1; // below 1/4: sticky only
+                    else int_fixed = {43'b0, mant_a_dec} << (int_exp + 12);
+                    lsb = int_fixed[64]; g_bit = int_fixed[63]; s_bit = |int_fixed[62:0];
+                    int_inexact = g_bit | s_bit;
+                    round_up = round_inc(rounding_mode, sign_a_dec, lsb, g_bit, 1'b0, s_bit);
+                    int_mag = {1'b0, int_fixed[95:64]} + 33'(round_up);
+                    cov[CV_FRAC_ROUNDED] = (int_exp < 0) && (int_mag != 0);
+                end
+
+                // range and sign
+                if (output_type == FP_TYPE_UINT32) begin
+                    if (sign_a_dec && int_mag != 0) begin
+                        flag_invalid = 1; result_int_32 = '0;
+                        cov[CV_UINT_NEGATIVE] = 1;
+                    end else if (int_mag[32]) begin
+                        flag_invalid = 1; flag_overflow = 1; flag_inexact = 1; result_int_32 = UINT32_MAX_VAL;
+                        cov[CV_ROUND_OVERFLOW] = (int_exp <= 31);
                     end else begin
-                        result_int = {11'b0, mant_a_dec} << -shift_amt;
-                        shifted_val = {11'b0, mant_a_dec} >> (shift_amt - 53);
+                        flag_inexact = int_inexact; result_int_32 = int_mag[31:0];
                     end
-
-                    // rounding
-                    lsb = result_int[0];
-                    g_bit = shifted_val[52];
-                    r_bit = shifted_val[51];
-                    s_bit = |shifted_val[50:0];
-                    flag_inexact = g_bit | r_bit | s_bit;
-                    case (rounding_mode)
-                        3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                        3'b001: round_up = 1'b0; // RTZ
-                        3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                        3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                        3'b100: round_up = flag_inexact; //RMM
-                        default: round_up = 1'b0;
-                    endcase
-                    result_int += {63'b0, round_up};
-
-                    if (result_int[31:0] == {1'b1, 31'b0}) begin
-                        if (sign_a_dec) begin result_int_32 = INT32_MIN_VAL; end
-                        else begin flag_invalid=1; flag_inexact=1; result_int_32=(sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL; end
+                end else begin
+                    if (int_mag > (sign_a_dec ? 33'h0_8000_0000 : 33'h0_7FFF_FFFF)) begin
+                        flag_invalid = 1; flag_overflow = 1; flag_inexact = 1; result_int_32 = (sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL;
+                        cov[CV_ROUND_OVERFLOW] = (int_exp <= 31);
+                    end else begin
+                        flag_inexact = int_inexact; result_int_32 = (sign_a_dec) ? -int_mag[31:0] : int_mag[31:0];
+                        cov[CV_INT_MIN] = sign_a_dec && int_mag[31];
                     end
-
-                    result_int_32 = (sign_a_dec) ? -$signed(result_int[31:0]) : result_int[31:0];
                 end
             end
 
             // --- INT -> DP Conversion ---
             else begin
                 final_sign = (input_type == FP_TYPE_INT32) && operand_in[31];
+                cov[CV_INT_NEGATIVE] = final_sign;
                 final_exp = 8'd158; // 2^31
-                result_int = (final_sign) ? {1'b0, -operand_in[31:0], 31'b0} : {1'b0, operand_in[31:0], 31'b0};
-
-                for(int i = 31 ; i >= 0 ; i--) begin
-                    if (!result_int[62]) begin final_exp -= 1; result_int <<= 1; end
-                    else begin i = 0; end
-                end
+                final_exp -= {2'b0, lz_int};
+                result_int = {1'b0, int_norm, 31'b0};
 
                 lsb = result_int[39];
                 g_bit = result_int[38];
                 r_bit = result_int[37];
-                s_bit = result_int[36];
+                s_bit = |result_int[36:31];
                 flag_inexact = g_bit | r_bit | s_bit;
-                case (rounding_mode)
-                    3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                    3'b001: round_up = 1'b0; // RTZ
-                    3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                    3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                    3'b100: round_up = flag_inexact; //RMM
-                    default: round_up = 1'b0;
-                endcase
+                round_up = round_inc(rounding_mode, final_sign, lsb, g_bit, r_bit, s_bit);
                 if (round_up) begin result_int += {24'b0, 1'b1, 39'b0}; end
-                if (result_int[63]) begin final_exp += 1; result_int >>= 1; end
+                if (result_int[63]) begin final_exp += 1; result_int >>= 1; cov[CV_ROUND_CARRY] = 1; end
 
                 final_mant = result_int[62:39];
             end
         end
+        cov[CV_RNE_UP +: 4] = round_up ? {rounding_mode == RMM, rounding_mode == RUP, rounding_mode == RDN, rounding_mode == RNE} : 4'b0;
     end
 
     always @(*) begin
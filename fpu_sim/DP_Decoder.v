@@ -1,7 +1,8 @@
 module DP_Decoder (
     input  [63:0] fp_in,
+    input  daz,                 // 1: a denormal decodes as a zero of the same sign
 
-    // SP decode
+    // DP decode
     output sign_out,
     output [10:0] exponent_out,
     output [52:0] mantissa_out,
@@ -13,20 +14,6 @@ module DP_Decoder (
     output is_denormal
 );
 
-    // intermediate logic
-    wire is_exp_max = (fp_in[62:52] == 11'h7FF);
-    wire is_exp_zero = (fp_in[62:52] == 0);
-    wire is_mant_zero = (fp_in[51:0] == 0);
-
-    // set flag
-    assign is_zero      = is_exp_zero && is_mant_zero;
-    assign is_infinity  = is_exp_max  && is_mant_zero;
-    assign is_nan       = is_exp_max  && !is_mant_zero;
-    assign is_denormal  = is_exp_zero && !is_mant_zero;
-
-    // decoded parts
-    assign sign_out = fp_in[63];
-    assign exponent_out = fp_in[62:52];
-    assign mantissa_out = (is_denormal) ?{1'b0, fp_in[51:0]} :{1'b1, fp_in[51:0]};
+    FP_Decoder #(.EXP_W(11), .MAN_W(52)) decoder ( .fp_in(fp_in), .daz(daz), .sign_out(sign_out), .exponent_out(exponent_out), .mantissa_out(mantissa_out), .is_zero(is_zero), .is_infinity(is_infinity), .is_nan(is_nan), .is_denormal(is_denormal) );
 
 endmodule
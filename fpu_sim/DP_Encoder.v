@@ -4,5 +4,5 @@ module DP_Encoder (
     input  [52:0] mantissa_in,
     output [63:0] fp_out
 );
-    assign fp_out = {sign_in, exponent_in, mantissa_in[51:0]};
+    FP_Encoder #(.EXP_W(11), .MAN_W(52)) encoder ( .sign_in(sign_in), .exponent_in(exponent_in), .mantissa_in(mantissa_in), .fp_out(fp_out) );
 endmodule
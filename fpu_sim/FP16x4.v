@@ -0,0 +1,182 @@
+module FP16x4 #(
+    parameter DENORMALS = 1             // 0: FTZ / DAZ on every lane, no denormal hardware
+) (
+    input [63:0]    operand_a,          // lane n in [16n+15:16n]
+    input [63:0]    operand_b,
+    input [63:0]    operand_c,
+    input           bf16,               // lanes hold BF16 instead of FP16
+    input           is_subtraction,
+    input           negate_product,     // -(a*b), FNMADD / FNMSUB
+    input           negate_addend,      // -c, FMSUB / FNMADD
+    input [1:0]     cvt_op,             // CVT_* below
+    input [1:0]     cvt_lane,           // source lane (D_H4), source pair (PS_H4, bit 0)
+    input [2:0]     rounding_mode,
+    input           ftz,                // denormal lanes read as zero, tiny lanes flush to zero
+    output [63:0]   add_result,
+    output [19:0]   add_flags,          // per lane {NV, DZ, OF, UF, NX}, lane n in [5n+4:5n]
+    output [63:0]   mul_result,
+    output [19:0]   mul_flags,
+    output [63:0]   fma_result,
+    output [19:0]   fma_flags,
+    output reg [63:0] cvt_result,
+    output reg [19:0] cvt_flags,
+    output [15:0]   add_cov,            // Corner paths any lane took, unit bins (fpu_cov.h)
+    output [15:0]   mul_cov,
+    output [17:0]   fma_cov,
+    output reg [13:0] cvt_cov
+);
+    // Four FP16 or BF16 lanes built from the format-parameterized FP_* units.
+    localparam CVT_H4_S  = 2'b00;       // FP32x2 a (lanes 1:0), FP32x2 b (lanes 3:2) -> 4 lanes
+    localparam CVT_H4_D  = 2'b01;       // FP64 a -> lane 0
+    localparam CVT_PS_H4 = 2'b10;       // lanes {2n+1, 2n}, n = cvt_lane[0] -> FP32x2
+    localparam CVT_D_H4  = 2'b11;       // lane cvt_lane -> FP64
+
+    // Both formats share one datapath per unit, sized for the wider exponent (BF16) and the wider
+    // fraction (FP16). A lane is held as {sign, 8-bit exponent, 10-bit fraction}: BF16 as is with
+    // three zero fraction bits below (narrow_man, rounded three bits higher), FP16 with its own
+    // 5-bit exponent and bias in the low exponent bits and Inf / NaN widened to all ones (narrow_exp).
+    localparam C_EXP = 8, C_MAN = 10;   // shared format
+    localparam H_EXP = 5, B_MAN = 7;    // FP16 exponent, BF16 fraction
+
+    wire narrow_exp = !bf16;
+    wire narrow_man = bf16;
+
+    function automatic [C_EXP+C_MAN:0] to_c(input [15:0] x, input bf);
+        if (bf) to_c = {x, 3'b0};
+        else    to_c = {x[15], (&x[14:10]) ? 8'hFF : {3'b0, x[14:10]}, x[9:0]};
+    endfunction
+
+    function automatic [15:0] from_c(input [C_EXP+C_MAN:0] x, input bf);
+        if (bf) from_c = x[18:3];
+        else    from_c = {x[18], (&x[17:10]) ? 5'h1F : x[14:10], x[9:0]};
+    endfunction
+
+    wire [63:0] from_s_result, to_s_result;
+    wire [19:0] from_s_flags;
+    wire [9:0]  to_s_flags;
+
+    // per-lane coverage, lane n in [W*n +: W]; a bin is hit when any lane hits it
+    wire [4*16-1:0] lane_add_cov, lane_mul_cov;
+    wire [4*18-1:0] lane_fma_cov;
+    wire [4*14-1:0] lane_from_s_cov;
+    wire [2*14-1:0] lane_to_s_cov;
+    assign add_cov = lane_add_cov[0 +: 16] | lane_add_cov[16 +: 16] | lane_add_cov[32 +: 16] | lane_add_cov[48 +: 16];
+    assign mul_cov = lane_mul_cov[0 +: 16] | lane_mul_cov[16 +: 16] | lane_mul_cov[32 +: 16] | lane_mul_cov[48 +: 16];
+    assign fma_cov = lane_fma_cov[0 +: 18] | lane_fma_cov[18 +: 18] | lane_fma_cov[36 +: 18] | lane_fma_cov[54 +: 18];
+
+    genvar l;
+    generate
+        for (l = 0; l < 4; l++) begin : lane
+            wire [C_EXP+C_MAN:0] ca = to_c(operand_a[16*l +: 16], bf16);
+            wire [C_EXP+C_MAN:0] cb = to_c(operand_b[16*l +: 16], bf16);
+            wire [C_EXP+C_MAN:0] cc = to_c(operand_c[16*l +: 16], bf16);
+
+            // --- Add / Sub ---
+            wire [C_EXP+C_MAN:0] c_add;
+            wire [3:0] add_f;               // {NV, OF, UF, NX}
+            FP_Adder #(.EXP_W(C_EXP), .MAN_W(C_MAN), .NARROW_EXP_W(H_EXP), .NARROW_MAN_W(B_MAN), .DENORMALS(DENORMALS)) adder (
+                .clk(1'b0), .hold(1'b0),
+                .operand_a(ca), .operand_b(cb), .is_subtraction(is_subtraction), .rounding_mode(rounding_mode),
+                .narrow_exp(narrow_exp), .narrow_man(narrow_man), .ftz(ftz),
+                .result(c_add), .flag_invalid(add_f[3]), .flag_overflow(add_f[2]), .flag_underflow(add_f[1]), .flag_inexact(add_f[0]),
+                .cov(lane_add_cov[16*l +: 16])
+            );
+            assign add_result[16*l +: 16] = from_c(c_add, bf16);
+            assign add_flags[5*l +: 5] = {add_f[3], 1'b0, add_f[2:0]};
+
+            // --- Multiply ---
+            wire [C_EXP+C_MAN:0] c_mul;
+            wire [3:0] mul_f;
+            FP_Multiplier #(.EXP_W(C_EXP), .MAN_W(C_MAN), .NARROW_EXP_W(H_EXP), .NARROW_MAN_W(B_MAN), .DENORMALS(DENORMALS)) multiplier (
+                .clk(1'b0), .hold(1'b0),
+                .operand_a(ca), .operand_b(cb), .rounding_mode(rounding_mode),
+                .narrow_exp(narrow_exp), .narrow_man(narrow_man), .ftz(ftz),
+                .result(c_mul), .flag_invalid(mul_f[3]), .flag_overflow(mul_f[2]), .flag_underflow(mul_f[1]), .flag_inexact(mul_f[0]),
+                .cov(lane_mul_cov[16*l +: 16])
+            );
+            assign mul_result[16*l +: 16] = from_c(c_mul, bf16);
+            assign mul_flags[5*l +: 5] = {mul_f[3], 1'b0, mul_f[2:0]};
+
+            // --- Fused Multiply-Add ---
+            wire [C_EXP+C_MAN:0] c_fma;
+            wire [3:0] fma_f;
+            FP_FMA #(.EXP_W(C_EXP), .MAN_W(C_MAN), .NARROW_EXP_W(H_EXP), .NARROW_MAN_W(B_MAN), .DENORMALS(DENORMALS)) fma_unit (
+                .clk(1'b0), .hold(1'b0),
+                .operand_a(ca), .operand_b(cb), .operand_c(cc),
+                .negate_product(negate_product), .negate_addend(negate_addend), .rounding_mode(rounding_mode),
+                .narrow_exp(narrow_exp), .narrow_man(narrow_man), .ftz(ftz),
+                .result(c_fma), .flag_invalid(fma_f[3]), .flag_overflow(fma_f[2]), .flag_underflow(fma_f[1]), .flag_inexact(fma_f[0]),
+                .cov(lane_fma_cov[18*l +: 18])
+            );
+            assign fma_result[16*l +: 16] = from_c(c_fma, bf16);
+            assign fma_flags[5*l +: 5] = {fma_f[3], 1'b0, fma_f[2:0]};
+
+            // --- FP32 -> 16-bit ---
+            wire [31:0] s_in = (l < 2) ? operand_a[32*(l%2) +: 32] : operand_b[32*(l%2) +: 32];
+            wire [C_EXP+C_MAN:0] c_from_s;
+            wire [3:0] from_s_f;
+            FP_Convert #(.IN_EXP_W(8), .IN_MAN_W(23), .OUT_EXP_W(C_EXP), .OUT_MAN_W(C_MAN), .OUT_NARROW_EXP_W(H_EXP), .OUT_NARROW_MAN_W(B_MAN), .DENORMALS(DENORMALS)) from_s_cvt (
+                .operand_in(s_in), .rounding_mode(rounding_mode), .narrow_exp(narrow_exp), .narrow_man(narrow_man), .ftz(ftz),
+                .result(c_from_s), .flag_invalid(from_s_f[3]), .flag_overflow(from_s_f[2]), .flag_underflow(from_s_f[1]), .flag_inexact(from_s_f[0]),
+                .cov(lane_from_s_cov[14*l +: 14])
+            );
+            assign from_s_result[16*l +: 16] = from_c(c_from_s, bf16);
+            assign from_s_flags[5*l +: 5] = {from_s_f[3], 1'b0, from_s_f[2:0]};
+        end
+
+        // --- 16-bit -> FP32, one pair of lanes ---
+        for (l = 0; l < 2; l++) begin : to_s
+            wire [C_EXP+C_MAN:0] cx = to_c(operand_a[16*(2*cvt_lane[0] + l) +: 16], bf16);
+            wire [3:0] to_s_f;
+            FP_Convert #(.IN_EXP_W(C_EXP), .IN_MAN_W(C_MAN), .OUT_EXP_W(8), .OUT_MAN_W(23), .IN_NARROW_EXP_W(H_EXP), .DENORMALS(DENORMALS)) to_s_cvt (
+                .operand_in(cx), .rounding_mode(rounding_mode), .narrow_exp(narrow_exp), .narrow_man(1'b0), .ftz(ftz),
+                .result(to_s_result[32*l +: 32]), .flag_invalid(to_s_f[3]), .flag_overflow(to_s_f[2]), .flag_underflow(to_s_f[1]), .flag_inexact(to_s_f[0]),
+                .cov(lane_to_s_cov[14*l +: 14])
+            );
+            assign to_s_flags[5*l +: 5] = {to_s_f[3], 1'b0, to_s_f[2:0]};
+        end
+    endgenerate
+
+    // --- FP64 <-> 16-bit, lane 0 / one selected lane ---
+    wire [C_EXP+C_MAN:0] c_d_lane = to_c(operand_a[16*cvt_lane +: 16], bf16);
+    wire [C_EXP+C_MAN:0] c_from_d;
+    wire [63:0] to_d;
+    wire [3:0] from_d_f, to_d_f;
+    wire [13:0] from_d_cov, to_d_cov;
+
+    FP_Convert #(.IN_EXP_W(11), .IN_MAN_W(52), .OUT_EXP_W(C_EXP), .OUT_MAN_W(C_MAN), .OUT_NARROW_EXP_W(H_EXP), .OUT_NARROW_MAN_W(B_MAN), .DENORMALS(DENORMALS)) from_d_cvt (
+        .operand_in(operand_a), .rounding_mode(rounding_mode), .narrow_exp(narrow_exp), .narrow_man(narrow_man), .ftz(ftz),
+        .result(c_from_d), .flag_invalid(from_d_f[3]), .flag_overflow(from_d_f[2]), .flag_underflow(from_d_f[1]), .flag_inexact(from_d_f[0]),
+        .cov(from_d_cov)
+    );
+    FP_Convert #(.IN_EXP_W(C_EXP), .IN_MAN_W(C_MAN), .OUT_EXP_W(11), .OUT_MAN_W(52), .IN_NARROW_EXP_W(H_EXP), .DENORMALS(DENORMALS)) to_d_cvt (
+        .operand_in(c_d_lane), .rounding_mode(rounding_mode), .narrow_exp(narrow_exp), .narrow_man(1'b0), .ftz(ftz),
+        .result(to_d), .flag_invalid(to_d_f[3]), .flag_overflow(to_d_f[2]), .flag_underflow(to_d_f[1]), .flag_inexact(to_d_f[0]),
+        .cov(to_d_cov)
+    );
+
+    // --- Conversion result ---
+    always @(*) begin
+        cvt_result = '0; cvt_flags = '0; cvt_cov = '0;
+        case (cvt_op)
+            CVT_H4_S: begin
+                cvt_result = from_s_result; cvt_flags = from_s_flags;
+                cvt_cov = lane_from_s_cov[0 +: 14] | lane_from_s_cov[14 +: 14] | lane_from_s_cov[28 +: 14] | lane_from_s_cov[42 +: 14];
+            end
+            CVT_H4_D: begin
+                cvt_result[15:0] = from_c(c_from_d, bf16);
+                cvt_flags[4:0] = {from_d_f[3], 1'b0, from_d_f[2:0]};
+                cvt_cov = from_d_cov;
+            end
+            CVT_PS_H4: begin
+                cvt_result = to_s_result; cvt_flags = {10'b0, to_s_flags};
+                cvt_cov = lane_to_s_cov[0 +: 14] | lane_to_s_cov[14 +: 14];
+            end
+            CVT_D_H4: begin
+                cvt_result = to_d;
+                cvt_flags[4:0] = {to_d_f[3], 1'b0, to_d_f[2:0]};
+                cvt_cov = to_d_cov;
+            end
+        endcase
+    end
+endmodule
@@ -1,25 +1,57 @@
-module FPU_Top (
+module FPU_Top #(
+    parameter TAG_WIDTH = 8,            // Width of the caller tag that travels with each op
+    parameter ADDER_DUAL_PATH = 0,      // 1: near/far dual-path FADD/FSUB normalization
+    parameter ADD_STAGES = 0,           // Pipeline register inside the FADD/FSUB units (0-1)
+    parameter MUL_STAGES = 0,           // Pipeline registers inside the FMUL units (0-3)
+    parameter FMA_STAGES = 0,           // Pipeline registers inside the FMA units (0-4)
+    parameter DIV_SRT = 0,              // 1: radix-4 SRT dividers with a carry-save remainder
+    parameter OPERAND_ISOLATION = 0,    // 1: per-unit operand registers, idle units see held inputs
+    parameter PERF_COUNTERS = 1,        // 0: no counter block, perf_rdata reads 0
+    parameter ISSUE_QUEUE_DEPTH = 0,    // >0: ops queued in front of each divider / sqrt unit
+    parameter COVERAGE = 0,             // 1: corner-path coverage bins of each op on cov_out
+    parameter DENORMALS = 1             // 0: every op runs as ftz, units built without denormal hardware
+) (
     input clk,
     input rst_n,
 
+    // --- Issue Handshake ---
+    input                       in_valid,   // An operation is presented on the inputs below
+    output                      in_ready,   // FPU accepts the operation on this clock edge
+    input  [TAG_WIDTH-1:0]      in_tag,     // Caller tag, returned with the result
+
     // --- Control Signals ---
     input [6:0]  func7,         // Operation code to select the function
     input [2:0]  func3,         // Rounding mode for arithmetic operations
     input [4:0]  rs2,           // For selecting convert type
+    input        ftz,           // 1: denormal inputs read as zero, tiny results flush to zero (always on without DENORMALS)
 
     // --- Data Inputs ---
     input [63:0] operand_a,      // Operand A (can be FP64, FP32, INT32, UINT32)
     input [63:0] operand_b,      // Operand B (can be FP64, FP32)
+    input [63:0] operand_c,      // Operand C, FMA addend (can be FP64, FP32)
+
+    // --- Result Handshake ---
+    output reg                  out_valid,  // result_out / flags hold a finished operation
+    output reg [TAG_WIDTH-1:0]  out_tag,    // Tag of the finished operation
 
     // --- Data Outputs ---
     output reg [63:0] result_out,     // Result of the operation
 
     // --- Status Flags ---
-    output       flag_invalid,
-    output       flag_divbyzero,
-    output       flag_overflow,
-    output       flag_underflow,
-    output       flag_inexact
+    output reg   flag_invalid,
+    output reg   flag_divbyzero,
+    output reg   flag_overflow,
+    output reg   flag_underflow,
+    output reg   flag_inexact,
+    output reg [19:0] flag_lanes,   // Per-lane {NV, DZ, OF, UF, NX}, lane n in [5n+4:5n] (packed ops only)
+
+    // --- Performance Counters ---
+    input  [5:0]  perf_addr,        // Counter to read, map at the counter block below
+    output [63:0] perf_rdata,       // Selected counter (combinational)
+    input         perf_clear,       // Zero all counters
+
+    // --- Functional Coverage ---
+    output [23:0] cov_out           // Corner-path bins of the op on out_tag (fpu_cov.h), 0 without COVERAGE
 );
 
     // --- Opcode Definitions ---
@@ -31,19 +63,203 @@ module FPU_Top (
     localparam OP_FMUL_D  = 7'b0001001; // FP64 Multiply
     localparam OP_FDIV_S  = 7'b0001100; // FP32 Divide
     localparam OP_FDIV_D  = 7'b0001101; // FP64 Divide
-    // localparam OP_FSQRT_S = 7'b0101100; // FP32 Square Root
-    // localparam OP_FSQRT_D = 7'b0101101; // FP64 Square Root
+    localparam OP_FMADD_S  = 7'b0010000; // FP32 a*b+c
+    localparam OP_FMADD_D  = 7'b0010001; // FP64 a*b+c
+    localparam OP_FMSUB_S  = 7'b0010100; // FP32 a*b-c
+    localparam OP_FMSUB_D  = 7'b0010101; // FP64 a*b-c
+    localparam OP_FNMSUB_S = 7'b0011000; // FP32 -(a*b)+c
+    localparam OP_FNMSUB_D = 7'b0011001; // FP64 -(a*b)+c
+    localparam OP_FNMADD_S = 7'b0011100; // FP32 -(a*b)-c
+    localparam OP_FNMADD_D = 7'b0011101; // FP64 -(a*b)-c
+    localparam OP_FSQRT_S = 7'b0101100; // FP32 Square Root
+    localparam OP_FSQRT_D = 7'b0101101; // FP64 Square Root
     localparam OP_FCMP_S  = 7'b1010000; // FP32 Compare
     localparam OP_FCMP_D  = 7'b1010001; // FP64 Compare
 
     localparam OP_FCVT_D_S  = 7'b0100001; // FP32 -> FP64
     localparam OP_FCVT_W_S  = 7'b1100000; // FP32 -> INT32 // UINT32 same
     localparam OP_FCVT_D_W  = 7'b1101001; // INT32 -> FP64 // UINT32 same
-    
+
     localparam OP_FCVT_S_D  = 7'b0100000; // FP64 -> FP32
     localparam OP_FCVT_W_D  = 7'b1100001; // FP64 -> INT32 // UINT32 same
     localparam OP_FCVT_S_W  = 7'b1101000; // INT32 -> FP32 // UINT32 same
 
+    // Packed FP32x2: fmt 2'b11, lane 0 in [31:0], lane 1 in [63:32]
+    localparam OP_FADD_PS   = 7'b0000011; // FP32x2 Add
+    localparam OP_FSUB_PS   = 7'b0000111; // FP32x2 Subtract
+    localparam OP_FMUL_PS   = 7'b0001011; // FP32x2 Multiply
+    localparam OP_FDIV_PS   = 7'b0001111; // FP32x2 Divide
+    localparam OP_FCMP_PS   = 7'b1010011; // FP32x2 Compare
+    localparam OP_FCVT_W_PS = 7'b1100011; // FP32x2 -> INT32x2 // UINT32 same
+    localparam OP_FCVT_PS_W = 7'b1101011; // INT32x2 -> FP32x2 // UINT32 same
+
+    // Packed 16-bit x4: fmt 2'b10, lane n in [16n+15:16n]; func7[6] selects BF16 over FP16
+    localparam OP_FADD_H4   = 7'b0000010; // FP16x4 Add
+    localparam OP_FSUB_H4   = 7'b0000110; // FP16x4 Subtract
+    localparam OP_FMUL_H4   = 7'b0001010; // FP16x4 Multiply
+    localparam OP_FMADD_H4  = 7'b0010010; // FP16x4 a*b+c
+    localparam OP_FMSUB_H4  = 7'b0010110; // FP16x4 a*b-c
+    localparam OP_FNMSUB_H4 = 7'b0011010; // FP16x4 -(a*b)+c
+    localparam OP_FNMADD_H4 = 7'b0011110; // FP16x4 -(a*b)-c
+    localparam OP_FADD_B4   = 7'b1000010; // BF16x4 Add
+    localparam OP_FSUB_B4   = 7'b1000110; // BF16x4 Subtract
+    localparam OP_FMUL_B4   = 7'b1001010; // BF16x4 Multiply
+    localparam OP_FMADD_B4  = 7'b1010010; // BF16x4 a*b+c
+    localparam OP_FMSUB_B4  = 7'b1010110; // BF16x4 a*b-c
+    localparam OP_FNMSUB_B4 = 7'b1011010; // BF16x4 -(a*b)+c
+    localparam OP_FNMADD_B4 = 7'b1011110; // BF16x4 -(a*b)-c
+
+    // 16-bit conversions: func7[4] selects BF16 over FP16, rs2 picks the source lane(s)
+    localparam OP_FCVT_H4_S  = 7'b0100010; // FP32x2 a, FP32x2 b -> FP16x4 {b, a}
+    localparam OP_FCVT_H4_D  = 7'b0100110; // FP64 -> FP16 lane 0
+    localparam OP_FCVT_PS_H4 = 7'b0100011; // FP16 lanes {2n+1, 2n} -> FP32x2, n = rs2[0]
+    localparam OP_FCVT_D_H4  = 7'b0100111; // FP16 lane rs2[1:0] -> FP64
+    localparam OP_FCVT_B4_S  = 7'b0110010; // FP32x2 a, FP32x2 b -> BF16x4 {b, a}
+    localparam OP_FCVT_B4_D  = 7'b0110110; // FP64 -> BF16 lane 0
+    localparam OP_FCVT_PS_B4 = 7'b0110011; // BF16 lanes {2n+1, 2n} -> FP32x2, n = rs2[0]
+    localparam OP_FCVT_D_B4  = 7'b0110111; // BF16 lane rs2[1:0] -> FP64
+
+    // --- Functional Unit Indices ---
+    // Each unit owns one execute-stage result register; U_ILLEGAL is the sink for unknown opcodes.
+    // Divides and square roots run in the background, so their results can overtake or trail other ops.
+    // Packed FP32x2 ops use the SP unit (INT32 -> FP32 the DP convert unit) plus a lane 1 copy.
+    // The U_HP_* units run all four 16-bit lanes, FP16 or BF16.
+    localparam U_SP_ADD = 0, U_DP_ADD = 1;
+    localparam U_SP_CMP = 2, U_DP_CMP = 3;
+    localparam U_SP_CVT = 4, U_DP_CVT = 5;
+    localparam U_SP_MUL = 6, U_DP_MUL = 7;
+    localparam U_SP_DIV = 8, U_DP_DIV = 9;
+    localparam U_SP_FMA = 10, U_DP_FMA = 11;
+    localparam U_SP_SQRT = 12, U_DP_SQRT = 13;
+    localparam U_HP_ADD = 14, U_HP_MUL = 15, U_HP_FMA = 16, U_HP_CVT = 17;
+    localparam U_ILLEGAL = 18;
+    localparam NUM_UNITS = 19;
+
+    // --- Conversion Type Constants ---
+    localparam FP32 = 2'b00, FP64 = 2'b01, INT32 = 2'b10, UINT32 = 2'b11;
+
+
+    // =========================================================================
+    // Stage 1: Decode register
+    // =========================================================================
+    reg [NUM_UNITS-1:0] unit_sel;       // one-hot unit for the incoming func7
+
+    always @(*) begin
+        unit_sel = '0;
+        case (func7)
+            OP_FADD_S, OP_FSUB_S,
+            OP_FADD_PS, OP_FSUB_PS:                 unit_sel[U_SP_ADD] = 1'b1;
+            OP_FADD_D, OP_FSUB_D:                   unit_sel[U_DP_ADD] = 1'b1;
+            OP_FCMP_S, OP_FCMP_PS:                  unit_sel[U_SP_CMP] = 1'b1;
+            OP_FCMP_D:                              unit_sel[U_DP_CMP] = 1'b1;
+            OP_FCVT_D_S, OP_FCVT_W_S, OP_FCVT_D_W,
+            OP_FCVT_W_PS:                           unit_sel[U_SP_CVT] = 1'b1;
+            OP_FCVT_S_D, OP_FCVT_W_D, OP_FCVT_S_W,
+            OP_FCVT_PS_W:                           unit_sel[U_DP_CVT] = 1'b1;
+            OP_FMUL_S, OP_FMUL_PS:                  unit_sel[U_SP_MUL] = 1'b1;
+            OP_FMUL_D:                              unit_sel[U_DP_MUL] = 1'b1;
+            OP_FDIV_S, OP_FDIV_PS:                  unit_sel[U_SP_DIV] = 1'b1;
+            OP_FDIV_D:                              unit_sel[U_DP_DIV] = 1'b1;
+            OP_FMADD_S, OP_FMSUB_S, OP_FNMSUB_S, OP_FNMADD_S: unit_sel[U_SP_FMA] = 1'b1;
+            OP_FMADD_D, OP_FMSUB_D, OP_FNMSUB_D, OP_FNMADD_D: unit_sel[U_DP_FMA] = 1'b1;
+            OP_FSQRT_S:                             unit_sel[U_SP_SQRT] = 1'b1;
+            OP_FSQRT_D:                             unit_sel[U_DP_SQRT] = 1'b1;
+            OP_FADD_H4, OP_FSUB_H4, OP_FADD_B4, OP_FSUB_B4: unit_sel[U_HP_ADD] = 1'b1;
+            OP_FMUL_H4, OP_FMUL_B4:                 unit_sel[U_HP_MUL] = 1'b1;
+            OP_FMADD_H4, OP_FMSUB_H4, OP_FNMSUB_H4, OP_FNMADD_H4,
+            OP_FMADD_B4, OP_FMSUB_B4, OP_FNMSUB_B4, OP_FNMADD_B4: unit_sel[U_HP_FMA] = 1'b1;
+            OP_FCVT_H4_S, OP_FCVT_H4_D, OP_FCVT_PS_H4, OP_FCVT_D_H4,
+            OP_FCVT_B4_S, OP_FCVT_B4_D, OP_FCVT_PS_B4, OP_FCVT_D_B4: unit_sel[U_HP_CVT] = 1'b1;
+            default:                                unit_sel[U_ILLEGAL] = 1'b1;
+        endcase
+    end
+
+    reg                 d_valid;
+    reg [NUM_UNITS-1:0] d_unit;
+    reg [TAG_WIDTH-1:0] d_tag;
+    reg [6:0]           d_func7;
+    reg [2:0]           d_func3;
+    reg [4:0]           d_rs2;
+    reg                 d_ftz;          // flush-to-zero / denormals-are-zero, applied inside the units
+
+    wire d_fire;                        // decode op moves into its execute register
+    wire d_packed = (d_func7[1:0] == 2'b11);    // FP32x2, lane 1 runs on the upper halves
+    wire d_free = !d_valid || d_fire;
+    assign in_ready = d_free;
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            d_valid <= 1'b0;
+        end else if (d_free) begin
+            d_valid <= in_valid;
+            if (in_valid) begin
+                d_unit      <= unit_sel;
+                d_tag       <= in_tag;
+                d_func7     <= func7;
+                d_func3     <= func3;
+                d_rs2       <= rs2;
+                d_ftz       <= ftz;
+            end
+        end
+    end
+
+    // --- Operand isolation ---
+    // u_operand_* is what unit u computes on while its op sits in decode. Shared, every unit sees
+    // every op's operands. Isolated, each unit keeps its own copy, loaded only when an op for it
+    // is accepted (the four U_HP_* units share FP16x4 and load as one group), so idle units keep
+    // their last inputs and do not toggle. unit_en is that load enable, one per unit, and maps
+    // onto a clock gate per copy in synthesis. The upper operand halves of the FP32 units are only
+    // read by the lane 1 copies (*_hi_inst) of the packed FP32x2 ops, so isolated they load with
+    // packed ops only and scalar FP32 ops leave the lane 1 copies alone.
+    wire [63:0] u_operand_a [0:NUM_UNITS-1];
+    wire [63:0] u_operand_b [0:NUM_UNITS-1];
+    wire [63:0] u_operand_c [0:NUM_UNITS-1];
+
+    localparam [NUM_UNITS-1:0] LANE1_HI = NUM_UNITS'((1 << U_SP_ADD) | (1 << U_SP_CMP) | (1 << U_SP_CVT) | (1 << U_SP_MUL) |
+                                                     (1 << U_SP_DIV) | (1 << U_SP_FMA) | (1 << U_SP_SQRT));
+    wire in_packed = (func7[1:0] == 2'b11);
+
+    reg [NUM_UNITS-1:0] unit_en;
+    always @(*) begin
+        unit_en = (d_free && in_valid) ? unit_sel : '0;
+        unit_en[U_HP_ADD] = d_free && in_valid && |unit_sel[U_HP_CVT:U_HP_ADD];
+    end
+
+    generate
+        if (OPERAND_ISOLATION) begin : operands_isolated
+            reg [63:0] a [0:NUM_UNITS-1];
+            reg [63:0] b [0:NUM_UNITS-1];
+            reg [63:0] c [0:NUM_UNITS-1];
+            always @(posedge clk) begin
+                for (int u = 0; u < NUM_UNITS; u++) begin
+                    if (unit_en[u]) begin a[u][31:0] <= operand_a[31:0]; b[u][31:0] <= operand_b[31:0]; c[u][31:0] <= operand_c[31:0]; end
+                    if (unit_en[u] && (in_packed || !LANE1_HI[u])) begin
+                        a[u][63:32] <= operand_a[63:32]; b[u][63:32] <= operand_b[63:32]; c[u][63:32] <= operand_c[63:32];
+                    end
+                end
+            end
+            for (genvar u = 0; u < NUM_UNITS; u++) begin : unit
+                assign u_operand_a[u] = a[u];
+                assign u_operand_b[u] = b[u];
+                assign u_operand_c[u] = c[u];
+            end
+        end else begin : operands_shared
+            reg [63:0] d_operand_a, d_operand_b, d_operand_c;
+            always @(posedge clk) begin
+                if (d_free && in_valid) begin d_operand_a <= operand_a; d_operand_b <= operand_b; d_operand_c <= operand_c; end
+            end
+            for (genvar u = 0; u < NUM_UNITS; u++) begin : unit
+                assign u_operand_a[u] = d_operand_a;
+                assign u_operand_b[u] = d_operand_b;
+                assign u_operand_c[u] = d_operand_c;
+            end
+        end
+    endgenerate
+
+
+    // =========================================================================
+    // Stage 2: Execute (one result register per unit)
+    // =========================================================================
 
     // --- Internal Wires for connecting to sub-modules ---
     reg [31:0] sp_adder_result;
@@ -73,234 +289,772 @@ module FPU_Top (
     reg [63:0] dp_divider_result;
     reg dp_divider_invalid, dp_divider_divbyzero, dp_divider_overflow, dp_divider_underflow, dp_divider_inexact;
 
+    reg [31:0] sp_fma_result;
+    reg sp_fma_invalid, sp_fma_overflow, sp_fma_underflow, sp_fma_inexact;
+
+    reg [63:0] dp_fma_result;
+    reg dp_fma_invalid, dp_fma_overflow, dp_fma_underflow, dp_fma_inexact;
+
+    reg sp_divider_busy, sp_divider_done;
+    reg dp_divider_busy, dp_divider_done;
+
+    reg [31:0] sp_sqrt_result;
+    reg sp_sqrt_invalid, sp_sqrt_inexact;
+    reg sp_sqrt_busy, sp_sqrt_done;
+
+    reg [63:0] dp_sqrt_result;
+    reg dp_sqrt_invalid, dp_sqrt_inexact;
+    reg dp_sqrt_busy, dp_sqrt_done;
+
+    // lane 1 of the packed FP32x2 ops
+    reg [31:0] sp_adder_hi_result;
+    reg sp_adder_hi_invalid, sp_adder_hi_overflow, sp_adder_hi_underflow, sp_adder_hi_inexact;
+
+    reg sp_cmp_hi, sp_cmp_hi_invalid;
+
+    reg [63:0] sp_convert_hi_result;
+    reg sp_convert_hi_invalid, sp_convert_hi_overflow, sp_convert_hi_underflow, sp_convert_hi_inexact;
+
+    reg [31:0] dp_convert_hi_result;
+    reg dp_convert_hi_invalid, dp_convert_hi_overflow, dp_convert_hi_underflow, dp_convert_hi_inexact;
+
+    reg [31:0] sp_multiplier_hi_result;
+    reg sp_multiplier_hi_invalid, sp_multiplier_hi_overflow, sp_multiplier_hi_underflow, sp_multiplier_hi_inexact;
+
+    reg [31:0] sp_divider_hi_result;
+    reg sp_divider_hi_invalid, sp_divider_hi_divbyzero, sp_divider_hi_overflow, sp_divider_hi_underflow, sp_divider_hi_inexact;
+    reg sp_divider_hi_busy, sp_divider_hi_done;
+
+    // packed 16-bit units, flags per lane
+    reg [63:0] hp_add_result, hp_mul_result, hp_fma_result, hp_cvt_result;
+    reg [19:0] hp_add_flags, hp_mul_flags, hp_fma_flags, hp_cvt_flags;
+
+    // corner-path coverage bins, one vector per unit instance (fpu_cov.h)
+    wire [15:0] sp_adder_cov, sp_adder_hi_cov, dp_adder_cov;
+    wire [9:0]  sp_cmp_cov, sp_cmp_hi_cov, dp_cmp_cov;
+    wire [14:0] sp_convert_cov, sp_convert_hi_cov;
+    wire [18:0] dp_convert_cov, dp_convert_hi_cov;
+    wire [15:0] sp_multiplier_cov, sp_multiplier_hi_cov, dp_multiplier_cov;
+    wire [15:0] sp_divider_cov, sp_divider_hi_cov, dp_divider_cov;
+    wire [17:0] sp_fma_cov, dp_fma_cov;
+    wire [10:0] sp_sqrt_cov, dp_sqrt_cov;
+    wire [15:0] hp_add_cov, hp_mul_cov;
+    wire [17:0] hp_fma_cov;
+    wire [13:0] hp_cvt_cov;
+
     // --- Sub-module control signals ---
     reg [1:0]  convert_input_type;
     reg [1:0]  convert_output_type;
 
-    // --- Conversion Type Constants ---
-    localparam FP32 = 2'b00, FP64 = 2'b01, INT32 = 2'b10, UINT32 = 2'b11;
+    always @(*) begin
+        convert_input_type = '0;
+        convert_output_type = '0;
+        case (d_func7)
+            OP_FCVT_D_S: begin convert_input_type = FP32; convert_output_type = FP64; end
+            OP_FCVT_W_S,
+            OP_FCVT_W_PS: begin convert_input_type = FP32; convert_output_type = (d_rs2[0]) ? UINT32 : INT32; end
+            OP_FCVT_D_W: begin convert_input_type = (d_rs2[0]) ? UINT32 : INT32; convert_output_type = FP64; end
+            OP_FCVT_S_D: begin convert_input_type = FP64; convert_output_type = FP32; end
+            OP_FCVT_W_D: begin convert_input_type = FP64; convert_output_type = (d_rs2[0]) ? UINT32 : INT32; end
+            OP_FCVT_S_W,
+            OP_FCVT_PS_W: begin convert_input_type = (d_rs2[0]) ? UINT32 : INT32; convert_output_type = FP32; end
+            default: begin convert_input_type = FP32; convert_output_type = FP64; end
+        endcase
+    end
+
+    // --- Pipelined unit handshake ---
+    // FADD/FSUB, FMUL and FMA ops leave decode into their unit's pipeline (ADD_STAGES, MUL_STAGES
+    // and FMA_STAGES registers deep), tag moving alongside; with 0 stages the unit is
+    // combinational and loads its execute register straight from decode. A finished op waiting
+    // for its execute register holds that unit's whole pipeline.
+    localparam PL_SP_ADD = 0, PL_DP_ADD = 1, PL_SP_MUL = 2, PL_DP_MUL = 3, PL_SP_FMA = 4, PL_DP_FMA = 5;
+    localparam NUM_PL = 6;
+
+    function automatic integer pl_unit(input integer n);
+        case (n)
+            PL_SP_ADD: pl_unit = U_SP_ADD;
+            PL_DP_ADD: pl_unit = U_DP_ADD;
+            PL_SP_MUL: pl_unit = U_SP_MUL;
+            PL_DP_MUL: pl_unit = U_DP_MUL;
+            PL_SP_FMA: pl_unit = U_SP_FMA;
+            default:   pl_unit = U_DP_FMA;
+        endcase
+    endfunction
+
+    function automatic integer pl_stages(input integer n);
+        case (n)
+            PL_SP_ADD, PL_DP_ADD: pl_stages = ADD_STAGES;
+            PL_SP_MUL, PL_DP_MUL: pl_stages = MUL_STAGES;
+            default:              pl_stages = FMA_STAGES;
+        endcase
+    endfunction
+
+    wire [NUM_PL-1:0]    pl_out_valid;
+    wire [NUM_PL-1:0]    pl_out_packed;
+    wire [TAG_WIDTH-1:0] pl_out_tag     [0:NUM_PL-1];
+    wire [NUM_PL-1:0]    pl_hold;
+
+    generate
+        for (genvar n = 0; n < NUM_PL; n++) begin : pl
+            localparam integer U = pl_unit(n);
+            localparam integer S = pl_stages(n);
+
+            if (S == 0) begin : comb
+                assign pl_out_valid[n] = d_valid && d_unit[U];
+                assign {pl_out_packed[n], pl_out_tag[n]} = {d_packed, d_tag};
+            end else begin : pipe
+                reg [S-1:0]         valid;
+                reg [TAG_WIDTH:0]   info [0:S-1];   // {packed, tag}
+
+                always @(posedge clk or negedge rst_n) begin
+                    if (!rst_n) begin
+                        valid <= '0;
+                    end else if (!pl_hold[n]) begin
+                        for (int s = S - 1; s > 0; s--) begin valid[s] <= valid[s-1]; info[s] <= info[s-1]; end
+                        valid[0] <= d_valid && d_unit[U]; info[0] <= {d_packed, d_tag};
+                    end
+                end
+
+                assign pl_out_valid[n] = valid[S-1];
+                assign {pl_out_packed[n], pl_out_tag[n]} = info[S-1];
+            end
+        end
+    endgenerate
 
     // --- Instantiate all functional units ---
-    SP_Adder sp_adder_inst (
-        .operand_a(operand_a[31:0]),
-        .operand_b(operand_b[31:0]),
-        .is_subtraction(func7[2]),
-        .rounding_mode(func3),
+    SP_Adder #(.DUAL_PATH(ADDER_DUAL_PATH), .STAGES(ADD_STAGES), .DENORMALS(DENORMALS)) sp_adder_inst (
+        .clk(clk), .hold(pl_hold[PL_SP_ADD]),
+        .operand_a(u_operand_a[U_SP_ADD][31:0]),
+        .operand_b(u_operand_b[U_SP_ADD][31:0]),
+        .is_subtraction(d_func7[2]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
         .result(sp_adder_result),
         .flag_invalid(sp_adder_invalid), .flag_overflow(sp_adder_overflow),
-        .flag_underflow(sp_adder_underflow), .flag_inexact(sp_adder_inexact)
+        .flag_underflow(sp_adder_underflow), .flag_inexact(sp_adder_inexact),
+        .cov(sp_adder_cov)
     );
-    DP_Adder dp_adder_inst (
-        .operand_a(operand_a),
-        .operand_b(operand_b),
-        .is_subtraction(func7[2]),
-        .rounding_mode(func3),
+    SP_Adder #(.DUAL_PATH(ADDER_DUAL_PATH), .STAGES(ADD_STAGES), .DENORMALS(DENORMALS)) sp_adder_hi_inst (
+        .clk(clk), .hold(pl_hold[PL_SP_ADD]),
+        .operand_a(u_operand_a[U_SP_ADD][63:32]),
+        .operand_b(u_operand_b[U_SP_ADD][63:32]),
+        .is_subtraction(d_func7[2]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
+        .result(sp_adder_hi_result),
+        .flag_invalid(sp_adder_hi_invalid), .flag_overflow(sp_adder_hi_overflow),
+        .flag_underflow(sp_adder_hi_underflow), .flag_inexact(sp_adder_hi_inexact),
+        .cov(sp_adder_hi_cov)
+    );
+    DP_Adder #(.DUAL_PATH(ADDER_DUAL_PATH), .STAGES(ADD_STAGES), .DENORMALS(DENORMALS)) dp_adder_inst (
+        .clk(clk), .hold(pl_hold[PL_DP_ADD]),
+        .operand_a(u_operand_a[U_DP_ADD]),
+        .operand_b(u_operand_b[U_DP_ADD]),
+        .is_subtraction(d_func7[2]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
         .result(dp_adder_result),
         .flag_invalid(dp_adder_invalid), .flag_overflow(dp_adder_overflow),
-        .flag_underflow(dp_adder_underflow), .flag_inexact(dp_adder_inexact)
+        .flag_underflow(dp_adder_underflow), .flag_inexact(dp_adder_inexact),
+        .cov(dp_adder_cov)
     );
 
-    SP_Compare sp_compare_inst (
-        .operand_a(operand_a[31:0]), .operand_b(operand_b[31:0]),
-        .func3(func3),
-        .flag_cmp(sp_cmp), .flag_invalid(sp_cmp_invalid)
+    SP_Compare #(.DENORMALS(DENORMALS)) sp_compare_inst (
+        .operand_a(u_operand_a[U_SP_CMP][31:0]), .operand_b(u_operand_b[U_SP_CMP][31:0]),
+        .func3(d_func3), .ftz(d_ftz),
+        .flag_cmp(sp_cmp), .flag_invalid(sp_cmp_invalid),
+        .cov(sp_cmp_cov)
     );
 
-    DP_Compare dp_compare_inst (
-        .operand_a(operand_a), .operand_b(operand_b),
-        .func3(func3),
-        .flag_cmp(dp_cmp), .flag_invalid(dp_cmp_invalid)
+    SP_Compare #(.DENORMALS(DENORMALS)) sp_compare_hi_inst (
+        .operand_a(u_operand_a[U_SP_CMP][63:32]), .operand_b(u_operand_b[U_SP_CMP][63:32]),
+        .func3(d_func3), .ftz(d_ftz),
+        .flag_cmp(sp_cmp_hi), .flag_invalid(sp_cmp_hi_invalid),
+        .cov(sp_cmp_hi_cov)
     );
 
-    SP_Convert sp_convert_inst (
-        .operand_in(operand_a[31:0]), 
+    DP_Compare #(.DENORMALS(DENORMALS)) dp_compare_inst (
+        .operand_a(u_operand_a[U_DP_CMP]), .operand_b(u_operand_b[U_DP_CMP]),
+        .func3(d_func3), .ftz(d_ftz),
+        .flag_cmp(dp_cmp), .flag_invalid(dp_cmp_invalid),
+        .cov(dp_cmp_cov)
+    );
+
+    SP_Convert #(.DENORMALS(DENORMALS)) sp_convert_inst (
+        .operand_in(u_operand_a[U_SP_CVT][31:0]),
         .input_type(convert_input_type),
         .output_type(convert_output_type),
-        .rounding_mode(func3),
+        .rounding_mode(d_func3), .ftz(d_ftz),
         .result(sp_convert_result),
         .flag_invalid(sp_convert_invalid), .flag_overflow(sp_convert_overflow),
-        .flag_underflow(sp_convert_underflow), .flag_inexact(sp_convert_inexact)
+        .flag_underflow(sp_convert_underflow), .flag_inexact(sp_convert_inexact),
+        .cov(sp_convert_cov)
+    );
+
+    SP_Convert #(.DENORMALS(DENORMALS)) sp_convert_hi_inst (
+        .operand_in(u_operand_a[U_SP_CVT][63:32]),
+        .input_type(convert_input_type),
+        .output_type(convert_output_type),
+        .rounding_mode(d_func3), .ftz(d_ftz),
+        .result(sp_convert_hi_result),
+        .flag_invalid(sp_convert_hi_invalid), .flag_overflow(sp_convert_hi_overflow),
+        .flag_underflow(sp_convert_hi_underflow), .flag_inexact(sp_convert_hi_inexact),
+        .cov(sp_convert_hi_cov)
     );
 
-    DP_Convert dp_convert_inst (
-        .operand_in(operand_a), 
+    DP_Convert #(.DENORMALS(DENORMALS)) dp_convert_inst (
+        .operand_in(u_operand_a[U_DP_CVT]),
         .input_type(convert_input_type),
         .output_type(convert_output_type),
-        .rounding_mode(func3),
+        .rounding_mode(d_func3), .ftz(d_ftz),
         .result(dp_convert_result),
         .flag_invalid(dp_convert_invalid), .flag_overflow(dp_convert_overflow),
-        .flag_underflow(dp_convert_underflow), .flag_inexact(dp_convert_inexact)
+        .flag_underflow(dp_convert_underflow), .flag_inexact(dp_convert_inexact),
+        .cov(dp_convert_cov)
+    );
+
+    // lane 1 of INT32x2 -> FP32x2; the scalar FP64 conversions use the upper half too, so with
+    // operand isolation it is gated to zero for them
+    wire [31:0] dp_convert_hi_in = (OPERAND_ISOLATION && !d_packed) ? 32'b0 : u_operand_a[U_DP_CVT][63:32];
+
+    DP_Convert #(.DENORMALS(DENORMALS)) dp_convert_hi_inst (
+        .operand_in({32'b0, dp_convert_hi_in}),
+        .input_type(convert_input_type),
+        .output_type(convert_output_type),
+        .rounding_mode(d_func3), .ftz(d_ftz),
+        .result(dp_convert_hi_result),
+        .flag_invalid(dp_convert_hi_invalid), .flag_overflow(dp_convert_hi_overflow),
+        .flag_underflow(dp_convert_hi_underflow), .flag_inexact(dp_convert_hi_inexact),
+        .cov(dp_convert_hi_cov)
     );
 
-    SP_Multiplier sp_multiplier_inst (
-        .operand_a(operand_a[31:0]), .operand_b(operand_b[31:0]),
-        .rounding_mode(func3),
+    SP_Multiplier #(.STAGES(MUL_STAGES), .DENORMALS(DENORMALS)) sp_multiplier_inst (
+        .clk(clk), .hold(pl_hold[PL_SP_MUL]),
+        .operand_a(u_operand_a[U_SP_MUL][31:0]), .operand_b(u_operand_b[U_SP_MUL][31:0]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
         .result(sp_multiplier_result),
         .flag_invalid(sp_multiplier_invalid), .flag_overflow(sp_multiplier_overflow),
-        .flag_underflow(sp_multiplier_underflow), .flag_inexact(sp_multiplier_inexact)
+        .flag_underflow(sp_multiplier_underflow), .flag_inexact(sp_multiplier_inexact),
+        .cov(sp_multiplier_cov)
+    );
+
+    SP_Multiplier #(.STAGES(MUL_STAGES), .DENORMALS(DENORMALS)) sp_multiplier_hi_inst (
+        .clk(clk), .hold(pl_hold[PL_SP_MUL]),
+        .operand_a(u_operand_a[U_SP_MUL][63:32]), .operand_b(u_operand_b[U_SP_MUL][63:32]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
+        .result(sp_multiplier_hi_result),
+        .flag_invalid(sp_multiplier_hi_invalid), .flag_overflow(sp_multiplier_hi_overflow),
+        .flag_underflow(sp_multiplier_hi_underflow), .flag_inexact(sp_multiplier_hi_inexact),
+        .cov(sp_multiplier_hi_cov)
     );
 
-    DP_Multiplier dp_multiplier_inst (
-        .operand_a(operand_a), .operand_b(operand_b),
-        .rounding_mode(func3),
+    DP_Multiplier #(.STAGES(MUL_STAGES), .DENORMALS(DENORMALS)) dp_multiplier_inst (
+        .clk(clk), .hold(pl_hold[PL_DP_MUL]),
+        .operand_a(u_operand_a[U_DP_MUL]), .operand_b(u_operand_b[U_DP_MUL]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
         .result(dp_multiplier_result),
         .flag_invalid(dp_multiplier_invalid), .flag_overflow(dp_multiplier_overflow),
-        .flag_underflow(dp_multiplier_underflow), .flag_inexact(dp_multiplier_inexact)
+        .flag_underflow(dp_multiplier_underflow), .flag_inexact(dp_multiplier_inexact),
+        .cov(dp_multiplier_cov)
+    );
+
+    // func7[2] negates the addend (FMSUB, FNMADD), func7[3] negates the product (FNMSUB, FNMADD)
+    SP_FMA #(.STAGES(FMA_STAGES), .DENORMALS(DENORMALS)) sp_fma_inst (
+        .clk(clk), .hold(pl_hold[PL_SP_FMA]),
+        .operand_a(u_operand_a[U_SP_FMA][31:0]), .operand_b(u_operand_b[U_SP_FMA][31:0]), .operand_c(u_operand_c[U_SP_FMA][31:0]),
+        .negate_product(d_func7[3]), .negate_addend(d_func7[2]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
+        .result(sp_fma_result),
+        .flag_invalid(sp_fma_invalid), .flag_overflow(sp_fma_overflow),
+        .flag_underflow(sp_fma_underflow), .flag_inexact(sp_fma_inexact),
+        .cov(sp_fma_cov)
     );
 
-    SP_Divider sp_divider_inst (
-        .operand_a(operand_a[31:0]), .operand_b(operand_b[31:0]),
-        .rounding_mode(func3),
+    DP_FMA #(.STAGES(FMA_STAGES), .DENORMALS(DENORMALS)) dp_fma_inst (
+        .clk(clk), .hold(pl_hold[PL_DP_FMA]),
+        .operand_a(u_operand_a[U_DP_FMA]), .operand_b(u_operand_b[U_DP_FMA]), .operand_c(u_operand_c[U_DP_FMA]),
+        .negate_product(d_func7[3]), .negate_addend(d_func7[2]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
+        .result(dp_fma_result),
+        .flag_invalid(dp_fma_invalid), .flag_overflow(dp_fma_overflow),
+        .flag_underflow(dp_fma_underflow), .flag_inexact(dp_fma_inexact),
+        .cov(dp_fma_cov)
+    );
+
+    // func7[2] / func7[3] as for FADD and FMA; the BF16 select bit differs for the conversions
+    FP16x4 #(.DENORMALS(DENORMALS)) hp_inst (
+        .operand_a(u_operand_a[U_HP_ADD]), .operand_b(u_operand_b[U_HP_ADD]), .operand_c(u_operand_c[U_HP_ADD]),
+        .bf16(d_unit[U_HP_CVT] ? d_func7[4] : d_func7[6]),
+        .is_subtraction(d_func7[2]),
+        .negate_product(d_func7[3]), .negate_addend(d_func7[2]),
+        .cvt_op({d_func7[0], d_func7[2]}), .cvt_lane(d_rs2[1:0]),
+        .rounding_mode(d_func3), .ftz(d_ftz),
+        .add_result(hp_add_result), .add_flags(hp_add_flags),
+        .mul_result(hp_mul_result), .mul_flags(hp_mul_flags),
+        .fma_result(hp_fma_result), .fma_flags(hp_fma_flags),
+        .cvt_result(hp_cvt_result), .cvt_flags(hp_cvt_flags),
+        .add_cov(hp_add_cov), .mul_cov(hp_mul_cov), .fma_cov(hp_fma_cov), .cvt_cov(hp_cvt_cov)
+    );
+
+    // --- Background unit issue ---
+    // Dividers and square roots latch their operands and rounding mode on start and run in the
+    // background: an op leaves decode as soon as its unit (or, with ISSUE_QUEUE_DEPTH > 0, the
+    // unit's issue queue) takes it, so later ops for other units keep flowing and complete
+    // first. bg_pending holds the running op's tag until its result is moved into the unit's
+    // execute register. A packed divide starts both lanes together and waits for the slower one.
+    localparam BG_SP_DIV = 0, BG_DP_DIV = 1, BG_SP_SQRT = 2, BG_DP_SQRT = 3;
+    localparam NUM_BG = 4;
+
+    function automatic integer bg_unit(input integer n);
+        case (n)
+            BG_SP_DIV:  bg_unit = U_SP_DIV;
+            BG_DP_DIV:  bg_unit = U_DP_DIV;
+            BG_SP_SQRT: bg_unit = U_SP_SQRT;
+            default:    bg_unit = U_DP_SQRT;
+        endcase
+    endfunction
+
+    // issued op: {packed, ftz, func3, tag, operand_b, operand_a}
+    localparam BG_W = 1 + 1 + 3 + TAG_WIDTH + 128;
+
+    wire [BG_W-1:0]      bg_issue [0:NUM_BG-1];     // op offered to unit n
+    wire [NUM_BG-1:0]    bg_issue_valid;
+    wire [NUM_BG-1:0]    bg_ready;                  // decode can hand unit n its op
+    wire [NUM_BG-1:0]    bg_done;
+    reg  [NUM_BG-1:0]    bg_pending;
+    reg  [NUM_BG-1:0]    bg_packed;
+    reg  [TAG_WIDTH-1:0] bg_tag     [0:NUM_BG-1];
+    wire [NUM_BG-1:0]    bg_start = bg_issue_valid & ~bg_pending;
+    reg  [NUM_UNITS-1:0] e_load;        // execute registers captured this cycle
+
+    wire [63:0] bg_a [0:NUM_BG-1];
+    wire [63:0] bg_b [0:NUM_BG-1];
+    wire [2:0]  bg_func3 [0:NUM_BG-1];
+    wire [NUM_BG-1:0] bg_ftz;
+
+    generate
+        for (genvar n = 0; n < NUM_BG; n++) begin : bg
+            localparam integer U = bg_unit(n);
+            wire [BG_W-1:0] d_entry = {d_packed, d_ftz, d_func3, d_tag, u_operand_b[U], u_operand_a[U]};
+
+            if (ISSUE_QUEUE_DEPTH == 0) begin : direct
+                assign bg_issue[n] = d_entry;
+                assign bg_issue_valid[n] = d_valid && d_unit[U];
+                assign bg_ready[n] = !bg_pending[n];
+            end else begin : queued
+                wire full, empty;
+                Issue_Queue #(.WIDTH(BG_W), .DEPTH(ISSUE_QUEUE_DEPTH)) queue (
+                    .clk(clk), .rst_n(rst_n),
+                    .push(d_fire && d_unit[U]), .push_data(d_entry), .full(full),
+                    .pop(bg_start[n]), .head(bg_issue[n]), .empty(empty)
+                );
+                assign bg_issue_valid[n] = !empty;
+                assign bg_ready[n] = !full;
+            end
+
+            assign bg_a[n] = bg_issue[n][63:0];
+            assign bg_b[n] = bg_issue[n][127:64];
+            assign bg_func3[n] = bg_issue[n][128 + TAG_WIDTH +: 3];
+            assign bg_ftz[n] = bg_issue[n][BG_W-2];
+        end
+    endgenerate
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            bg_pending <= '0;
+        end else begin
+            for (int n = 0; n < NUM_BG; n++) begin
+                if (bg_start[n]) begin
+                    bg_pending[n] <= 1'b1;
+                    bg_packed[n] <= bg_issue[n][BG_W-1];
+                    bg_tag[n] <= bg_issue[n][128 +: TAG_WIDTH];
+                end else if (e_load[bg_unit(n)]) begin
+                    bg_pending[n] <= 1'b0;
+                end
+            end
+        end
+    end
+
+    assign bg_done[BG_SP_DIV] = sp_divider_done && (!bg_packed[BG_SP_DIV] || sp_divider_hi_done);
+    assign bg_done[BG_DP_DIV] = dp_divider_done;
+    assign bg_done[BG_SP_SQRT] = sp_sqrt_done;
+    assign bg_done[BG_DP_SQRT] = dp_sqrt_done;
+
+    SP_Divider #(.SRT(DIV_SRT), .DENORMALS(DENORMALS)) sp_divider_inst (
+        .clk(clk), .rst_n(rst_n),
+        .start(bg_start[BG_SP_DIV]), .busy(sp_divider_busy), .done(sp_divider_done),
+        .operand_a(bg_a[BG_SP_DIV][31:0]), .operand_b(bg_b[BG_SP_DIV][31:0]),
+        .rounding_mode(bg_func3[BG_SP_DIV]), .ftz(bg_ftz[BG_SP_DIV]),
         .result(sp_divider_result),
         .flag_invalid(sp_divider_invalid), .flag_divbyzero(sp_divider_divbyzero),
-        .flag_overflow(sp_divider_overflow), .flag_underflow(sp_divider_underflow), .flag_inexact(sp_divider_inexact)
+        .flag_overflow(sp_divider_overflow), .flag_underflow(sp_divider_underflow), .flag_inexact(sp_divider_inexact),
+        .cov(sp_divider_cov)
+    );
+
+    SP_Divider #(.SRT(DIV_SRT), .DENORMALS(DENORMALS)) sp_divider_hi_inst (
+        .clk(clk), .rst_n(rst_n),
+        .start(bg_start[BG_SP_DIV] && bg_issue[BG_SP_DIV][BG_W-1]), .busy(sp_divider_hi_busy), .done(sp_divider_hi_done),
+        .operand_a(bg_a[BG_SP_DIV][63:32]), .operand_b(bg_b[BG_SP_DIV][63:32]),
+        .rounding_mode(bg_func3[BG_SP_DIV]), .ftz(bg_ftz[BG_SP_DIV]),
+        .result(sp_divider_hi_result),
+        .flag_invalid(sp_divider_hi_invalid), .flag_divbyzero(sp_divider_hi_divbyzero),
+        .flag_overflow(sp_divider_hi_overflow), .flag_underflow(sp_divider_hi_underflow), .flag_inexact(sp_divider_hi_inexact),
+        .cov(sp_divider_hi_cov)
     );
 
-    DP_Divider dp_divider_inst (
-        .operand_a(operand_a), .operand_b(operand_b),
-        .rounding_mode(func3),
+    DP_Divider #(.SRT(DIV_SRT), .DENORMALS(DENORMALS)) dp_divider_inst (
+        .clk(clk), .rst_n(rst_n),
+        .start(bg_start[BG_DP_DIV]), .busy(dp_divider_busy), .done(dp_divider_done),
+        .operand_a(bg_a[BG_DP_DIV]), .operand_b(bg_b[BG_DP_DIV]),
+        .rounding_mode(bg_func3[BG_DP_DIV]), .ftz(bg_ftz[BG_DP_DIV]),
         .result(dp_divider_result),
         .flag_invalid(dp_divider_invalid), .flag_divbyzero(dp_divider_divbyzero),
-        .flag_overflow(dp_divider_overflow), .flag_underflow(dp_divider_underflow), .flag_inexact(dp_divider_inexact)
+        .flag_overflow(dp_divider_overflow), .flag_underflow(dp_divider_underflow), .flag_inexact(dp_divider_inexact),
+        .cov(dp_divider_cov)
     );
 
-    // FP_Sqrt sqrt_inst (
-    //     .clk(clk), .rst_n(rst_n),
-    //     .operand_a(operand_a),
-    //     .is_double_precision(is_double),
-    //     .rounding_mode(rounding_mode),
-    //     .result(sqrt_result),
-    //     .flag_invalid(sqrt_invalid), .flag_overflow(sqrt_overflow),
-    //     .flag_underflow(sqrt_underflow), .flag_inexact(sqrt_inexact)
-    // );
+    SP_Sqrt #(.DENORMALS(DENORMALS)) sp_sqrt_inst (
+        .clk(clk), .rst_n(rst_n),
+        .start(bg_start[BG_SP_SQRT]), .busy(sp_sqrt_busy), .done(sp_sqrt_done),
+        .operand_a(bg_a[BG_SP_SQRT][31:0]),
+        .rounding_mode(bg_func3[BG_SP_SQRT]), .ftz(bg_ftz[BG_SP_SQRT]),
+        .result(sp_sqrt_result),
+        .flag_invalid(sp_sqrt_invalid), .flag_inexact(sp_sqrt_inexact),
+        .cov(sp_sqrt_cov)
+    );
+
+    DP_Sqrt #(.DENORMALS(DENORMALS)) dp_sqrt_inst (
+        .clk(clk), .rst_n(rst_n),
+        .start(bg_start[BG_DP_SQRT]), .busy(dp_sqrt_busy), .done(dp_sqrt_done),
+        .operand_a(bg_a[BG_DP_SQRT]),
+        .rounding_mode(bg_func3[BG_DP_SQRT]), .ftz(bg_ftz[BG_DP_SQRT]),
+        .result(dp_sqrt_result),
+        .flag_invalid(dp_sqrt_invalid), .flag_inexact(dp_sqrt_inexact),
+        .cov(dp_sqrt_cov)
+    );
 
+    // --- Unit outputs, flags packed as {NV, DZ, OF, UF, NX} ---
+    // Packed results carry lane n in its slice of [63:0]; u_flags is lane 0 and u_flags_hi
+    // lanes 3..1 (FP32x2 only uses lane 1).
+    wire [63:0] u_result [0:NUM_UNITS-1];
+    wire [4:0]  u_flags  [0:NUM_UNITS-1];
 
-    // --- Main Combinational Logic: Opcode Decoding and Output Muxing ---
+    assign u_result[U_SP_ADD] = pl_out_packed[PL_SP_ADD] ? {sp_adder_hi_result, sp_adder_result} : {32'b0, sp_adder_result};
+    assign u_flags [U_SP_ADD] = {sp_adder_invalid, 1'b0, sp_adder_overflow, sp_adder_underflow, sp_adder_inexact};
+    assign u_result[U_DP_ADD] = dp_adder_result;
+    assign u_flags [U_DP_ADD] = {dp_adder_invalid, 1'b0, dp_adder_overflow, dp_adder_underflow, dp_adder_inexact};
+    assign u_result[U_SP_CMP] = d_packed ? {31'b0, sp_cmp_hi, 31'b0, sp_cmp} : {63'b0, sp_cmp};
+    assign u_flags [U_SP_CMP] = {sp_cmp_invalid, 4'b0};
+    assign u_result[U_DP_CMP] = {63'b0, dp_cmp};
+    assign u_flags [U_DP_CMP] = {dp_cmp_invalid, 4'b0};
+    assign u_result[U_SP_CVT] = d_packed ? {sp_convert_hi_result[31:0], sp_convert_result[31:0]} : sp_convert_result;
+    assign u_flags [U_SP_CVT] = {sp_convert_invalid, 1'b0, sp_convert_overflow, sp_convert_underflow, sp_convert_inexact};
+    assign u_result[U_DP_CVT] = d_packed ? {dp_convert_hi_result, dp_convert_result} : {32'b0, dp_convert_result};
+    assign u_flags [U_DP_CVT] = {dp_convert_invalid, 1'b0, dp_convert_overflow, dp_convert_underflow, dp_convert_inexact};
+    assign u_result[U_SP_MUL] = pl_out_packed[PL_SP_MUL] ? {sp_multiplier_hi_result, sp_multiplier_result} : {32'b0, sp_multiplier_result};
+    assign u_flags [U_SP_MUL] = {sp_multiplier_invalid, 1'b0, sp_multiplier_overflow, sp_multiplier_underflow, sp_multiplier_inexact};
+    assign u_result[U_DP_MUL] = dp_multiplier_result;
+    assign u_flags [U_DP_MUL] = {dp_multiplier_invalid, 1'b0, dp_multiplier_overflow, dp_multiplier_underflow, dp_multiplier_inexact};
+    assign u_result[U_SP_DIV] = bg_packed[BG_SP_DIV] ? {sp_divider_hi_result, sp_divider_result} : {32'b0, sp_divider_result};
+    assign u_flags [U_SP_DIV] = {sp_divider_invalid, sp_divider_divbyzero, sp_divider_overflow, sp_divider_underflow, sp_divider_inexact};
+    assign u_result[U_DP_DIV] = dp_divider_result;
+    assign u_flags [U_DP_DIV] = {dp_divider_invalid, dp_divider_divbyzero, dp_divider_overflow, dp_divider_underflow, dp_divider_inexact};
+    assign u_result[U_SP_FMA] = {32'b0, sp_fma_result};
+    assign u_flags [U_SP_FMA] = {sp_fma_invalid, 1'b0, sp_fma_overflow, sp_fma_underflow, sp_fma_inexact};
+    assign u_result[U_DP_FMA] = dp_fma_result;
+    assign u_flags [U_DP_FMA] = {dp_fma_invalid, 1'b0, dp_fma_overflow, dp_fma_underflow, dp_fma_inexact};
+    assign u_result[U_SP_SQRT] = {32'b0, sp_sqrt_result};
+    assign u_flags [U_SP_SQRT] = {sp_sqrt_invalid, 3'b0, sp_sqrt_inexact};
+    assign u_result[U_DP_SQRT] = dp_sqrt_result;
+    assign u_flags [U_DP_SQRT] = {dp_sqrt_invalid, 3'b0, dp_sqrt_inexact};
+    assign u_result[U_HP_ADD] = hp_add_result;
+    assign u_flags [U_HP_ADD] = hp_add_flags[4:0];
+    assign u_result[U_HP_MUL] = hp_mul_result;
+    assign u_flags [U_HP_MUL] = hp_mul_flags[4:0];
+    assign u_result[U_HP_FMA] = hp_fma_result;
+    assign u_flags [U_HP_FMA] = hp_fma_flags[4:0];
+    assign u_result[U_HP_CVT] = hp_cvt_result;
+    assign u_flags [U_HP_CVT] = hp_cvt_flags[4:0];
+    // Default to an invalid operation, return QNaN
+    assign u_result[U_ILLEGAL] = 64'h7FF8_0000_0000_0000;
+    assign u_flags [U_ILLEGAL] = 5'b10000;
+
+    reg [14:0] u_flags_hi [0:NUM_UNITS-1];
     always @(*) begin
-        // Default assignments to avoid latches
-        result_out     = '0;
-        flag_invalid   = 1'b0;
-        flag_divbyzero = 1'b0;
-        flag_overflow  = 1'b0;
-        flag_underflow = 1'b0;
-        flag_inexact   = 1'b0;
+        for (int u = 0; u < NUM_UNITS; u++) u_flags_hi[u] = '0;
+        if (pl_out_packed[PL_SP_ADD]) begin
+            u_flags_hi[U_SP_ADD] = {10'b0, sp_adder_hi_invalid, 1'b0, sp_adder_hi_overflow, sp_adder_hi_underflow, sp_adder_hi_inexact};
+        end
+        if (d_packed) begin
+            u_flags_hi[U_SP_CMP] = {10'b0, sp_cmp_hi_invalid, 4'b0};
+            u_flags_hi[U_SP_CVT] = {10'b0, sp_convert_hi_invalid, 1'b0, sp_convert_hi_overflow, sp_convert_hi_underflow, sp_convert_hi_inexact};
+            u_flags_hi[U_DP_CVT] = {10'b0, dp_convert_hi_invalid, 1'b0, dp_convert_hi_overflow, dp_convert_hi_underflow, dp_convert_hi_inexact};
+        end
+        if (bg_packed[BG_SP_DIV]) begin
+            u_flags_hi[U_SP_DIV] = {10'b0, sp_divider_hi_invalid, sp_divider_hi_divbyzero, sp_divider_hi_overflow, sp_divider_hi_underflow, sp_divider_hi_inexact};
+        end
+        if (pl_out_packed[PL_SP_MUL]) begin
+            u_flags_hi[U_SP_MUL] = {10'b0, sp_multiplier_hi_invalid, 1'b0, sp_multiplier_hi_overflow, sp_multiplier_hi_underflow, sp_multiplier_hi_inexact};
+        end
+        u_flags_hi[U_HP_ADD] = hp_add_flags[19:5];
+        u_flags_hi[U_HP_MUL] = hp_mul_flags[19:5];
+        u_flags_hi[U_HP_FMA] = hp_fma_flags[19:5];
+        u_flags_hi[U_HP_CVT] = hp_cvt_flags[19:5];
+    end
 
-        convert_input_type = '0;
-        convert_output_type = '0;
+    // --- Execute-stage result registers ---
+    reg [NUM_UNITS-1:0] e_valid;
+    reg [TAG_WIDTH-1:0] e_tag    [0:NUM_UNITS-1];
+    reg [63:0]          e_result [0:NUM_UNITS-1];
+    reg [19:0]          e_flags  [0:NUM_UNITS-1];   // {lane 3, lane 2, lane 1, lane 0}
 
-        // Decode opcode to select operation and drive outputs
-        case (func7)
-            OP_FADD_S, OP_FSUB_S: begin
-                result_out = {32'b0, sp_adder_result};
-                {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {sp_adder_invalid, sp_adder_overflow, sp_adder_underflow, sp_adder_inexact};
+    reg [NUM_UNITS-1:0] wb_grant;       // one-hot, register drained into stage 3 this cycle
+    wire [NUM_UNITS-1:0] e_free = ~e_valid | wb_grant;
+
+    // unit takes the decode op this cycle (single-cycle units whenever their register is free)
+    reg [NUM_UNITS-1:0] d_accept;
+    always @(*) begin
+        d_accept = e_free;
+        for (int n = 0; n < NUM_BG; n++) d_accept[bg_unit(n)] = bg_ready[n];
+        for (int n = 0; n < NUM_PL; n++) d_accept[pl_unit(n)] = !pl_hold[n];
+    end
+
+    assign d_fire = d_valid && |(d_unit & d_accept);
+
+    generate
+        for (genvar n = 0; n < NUM_PL; n++) begin : pl_stall
+            assign pl_hold[n] = pl_out_valid[n] && !e_free[pl_unit(n)];
+        end
+    endgenerate
+
+    // pipelined and background units load their register when they finish, with the tag they started with
+    reg [TAG_WIDTH-1:0] e_load_tag [0:NUM_UNITS-1];
+    always @(*) begin
+        e_load = d_fire ? d_unit : '0;
+        for (int u = 0; u < NUM_UNITS; u++) e_load_tag[u] = d_tag;
+        for (int n = 0; n < NUM_PL; n++) begin
+            e_load[pl_unit(n)] = pl_out_valid[n] && e_free[pl_unit(n)];
+            e_load_tag[pl_unit(n)] = pl_out_tag[n];
+        end
+        for (int n = 0; n < NUM_BG; n++) begin
+            e_load[bg_unit(n)] = bg_pending[n] && bg_done[n] && e_free[bg_unit(n)];
+            e_load_tag[bg_unit(n)] = bg_tag[n];
+        end
+    end
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            e_valid <= '0;
+        end else begin
+            for (int u = 0; u < NUM_UNITS; u++) begin
+                if (wb_grant[u]) e_valid[u] <= 1'b0;
+                if (e_load[u]) begin
+                    e_valid[u]  <= 1'b1;
+                    e_tag[u]    <= e_load_tag[u];
+                    e_result[u] <= u_result[u];
+                    e_flags[u]  <= {u_flags_hi[u], u_flags[u]};
+                end
             end
-            OP_FADD_D, OP_FSUB_D: begin
-                result_out = dp_adder_result;
-                {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {dp_adder_invalid, dp_adder_overflow, dp_adder_underflow, dp_adder_inexact};
+        end
+    end
+
+
+    // =========================================================================
+    // Stage 3: Result mux register
+    // =========================================================================
+    // round-robin: the search starts after the last granted unit, so a valid register waits at
+    // most NUM_UNITS - 1 cycles however busy the single-cycle units keep the others. wb_mask keeps
+    // the units above the last grant; the lowest valid unit under the mask wins, or the lowest
+    // valid unit overall when none is left above. x & -x isolates the lowest set bit.
+    reg  [NUM_UNITS-1:0] wb_mask;
+    wire [NUM_UNITS-1:0] wb_req_masked = e_valid & wb_mask;
+    wire [NUM_UNITS-1:0] wb_pick_masked = wb_req_masked & (~wb_req_masked + NUM_UNITS'(1));
+    wire [NUM_UNITS-1:0] wb_pick_all = e_valid & (~e_valid + NUM_UNITS'(1));
+
+    always @(*) begin
+        wb_grant = (|wb_req_masked) ? wb_pick_masked : wb_pick_all;
+    end
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) wb_mask <= '1;                                           // unit 0 first after reset
+        else if (|wb_grant) wb_mask <= ~((wb_grant << 1) - NUM_UNITS'(1));   // units above the grant
+    end
+
+    reg [63:0]          wb_result;
+    reg [19:0]          wb_flags;
+    reg [TAG_WIDTH-1:0] wb_tag;
+
+    always @(*) begin
+        wb_result = '0; wb_flags = '0; wb_tag = '0;
+        for (int u = 0; u < NUM_UNITS; u++) begin
+            if (wb_grant[u]) begin
+                wb_result = e_result[u];
+                wb_flags  = e_flags[u];
+                wb_tag    = e_tag[u];
             end
-            OP_FCMP_S: begin
-                result_out = {63'b0, sp_cmp};
-                flag_invalid = sp_cmp_invalid;
+        end
+    end
+
+    wire [4:0] wb_summary = wb_flags[19:15] | wb_flags[14:10] | wb_flags[9:5] | wb_flags[4:0];
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            out_valid <= 1'b0;
+            out_tag <= '0;
+            result_out <= '0;
+            {flag_invalid, flag_divbyzero, flag_overflow, flag_underflow, flag_inexact} <= '0;
+            flag_lanes <= '0;
+        end else begin
+            out_valid <= |wb_grant;
+            if (|wb_grant) begin
+                out_tag <= wb_tag;
+                result_out <= wb_result;
+                // summary flags are the OR of all lanes
+                {flag_invalid, flag_divbyzero, flag_overflow, flag_underflow, flag_inexact} <= wb_summary;
+                flag_lanes <= wb_flags;
+            end
+        end
+    end
+
+
+    // =========================================================================
+    // Functional coverage (cov_out)
+    // =========================================================================
+    // Each unit reports the corner paths (special operands, rounding directions, carries,
+    // overflow / underflow exits) its op took as a bit vector, bins listed in fpu_cov.h. With
+    // COVERAGE set the vector travels with the op through the execute and result registers like
+    // its flags, so cov_out belongs to the op on out_tag; a packed FP32x2 op reports the union of
+    // its two lanes and a 16-bit op the union of its four. Illegal ops have no bins.
+    generate
+        if (COVERAGE) begin : coverage
+            wire [23:0] u_cov [0:NUM_UNITS-1];
+            assign u_cov[U_SP_ADD]  = 24'(sp_adder_cov | (pl_out_packed[PL_SP_ADD] ? sp_adder_hi_cov : '0));
+            assign u_cov[U_DP_ADD]  = 24'(dp_adder_cov);
+            assign u_cov[U_SP_CMP]  = 24'(sp_cmp_cov | (d_packed ? sp_cmp_hi_cov : '0));
+            assign u_cov[U_DP_CMP]  = 24'(dp_cmp_cov);
+            assign u_cov[U_SP_CVT]  = 24'(sp_convert_cov | (d_packed ? sp_convert_hi_cov : '0));
+            assign u_cov[U_DP_CVT]  = 24'(dp_convert_cov | (d_packed ? dp_convert_hi_cov : '0));
+            assign u_cov[U_SP_MUL]  = 24'(sp_multiplier_cov | (pl_out_packed[PL_SP_MUL] ? sp_multiplier_hi_cov : '0));
+            assign u_cov[U_DP_MUL]  = 24'(dp_multiplier_cov);
+            assign u_cov[U_SP_DIV]  = 24'(sp_divider_cov | (bg_packed[BG_SP_DIV] ? sp_divider_hi_cov : '0));
+            assign u_cov[U_DP_DIV]  = 24'(dp_divider_cov);
+            assign u_cov[U_SP_FMA]  = 24'(sp_fma_cov);
+            assign u_cov[U_DP_FMA]  = 24'(dp_fma_cov);
+            assign u_cov[U_SP_SQRT] = 24'(sp_sqrt_cov);
+            assign u_cov[U_DP_SQRT] = 24'(dp_sqrt_cov);
+            assign u_cov[U_HP_ADD]  = 24'(hp_add_cov);
+            assign u_cov[U_HP_MUL]  = 24'(hp_mul_cov);
+            assign u_cov[U_HP_FMA]  = 24'(hp_fma_cov);
+            assign u_cov[U_HP_CVT]  = 24'(hp_cvt_cov);
+            assign u_cov[U_ILLEGAL] = '0;
+
+            reg [23:0] e_cov [0:NUM_UNITS-1];
+            reg [23:0] wb_cov, out_cov;
+            always @(posedge clk) begin
+                for (int u = 0; u < NUM_UNITS; u++) if (e_load[u]) e_cov[u] <= u_cov[u];
             end
-            OP_FCMP_D: begin
-                result_out = {63'b0, dp_cmp};
-                flag_invalid = dp_cmp_invalid;
+            always @(*) begin
+                wb_cov = '0;
+                for (int u = 0; u < NUM_UNITS; u++) if (wb_grant[u]) wb_cov = e_cov[u];
             end
-            OP_FCVT_D_S, OP_FCVT_W_S, OP_FCVT_D_W: begin
-                result_out = sp_convert_result;
-                {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {sp_convert_invalid, sp_convert_overflow, sp_convert_underflow, sp_convert_inexact};
-                case (func7)
-                    OP_FCVT_D_S: begin convert_input_type = FP32; convert_output_type = FP64; end
-                    OP_FCVT_W_S: begin convert_input_type = FP32; convert_output_type = (rs2[0]) ? UINT32 : INT32; end
-                    OP_FCVT_D_W: begin convert_input_type = (rs2[0]) ? UINT32 : INT32; convert_output_type = FP64; end
-                    default: begin convert_input_type = FP32; convert_output_type = FP64; end
-                endcase
+            always @(posedge clk or negedge rst_n) begin
+                if (!rst_n) out_cov <= '0;
+                else if (|wb_grant) out_cov <= wb_cov;
             end
-            OP_FCVT_S_D, OP_FCVT_W_D, OP_FCVT_S_W: begin
-                result_out = {32'b0, dp_convert_result};
-                {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {dp_convert_invalid, dp_convert_overflow, dp_convert_underflow, dp_convert_inexact};
+            assign cov_out = out_cov;
+        end else begin : no_coverage
+            assign cov_out = '0;
+        end
+    endgenerate
+
+
+    // =========================================================================
+    // Performance counters (perf_addr)
+    // =========================================================================
+    //   0..18   ops accepted per unit, indexed like U_*
+    //   19      stall cycles, in_valid while !in_ready
+    //   20..23  busy cycles of SP_Divider (either lane), DP_Divider, SP_Sqrt, DP_Sqrt
+    //   24      cycles a divide holds decode waiting for its divider
+    //   25..29  results raising NV, DZ, OF, UF, NX
+    //   30      accepted ops with a denormal FP32 / FP64 operand
+    //   31      accepted ops with a NaN FP32 / FP64 operand
+    //   32      cycles since reset or perf_clear
+    localparam PERF_STALL = 19, PERF_BUSY = 20, PERF_DIV_WAIT = 24, PERF_FLAGS = 25;
+    localparam PERF_DENORMAL = 30, PERF_NAN = 31, PERF_CYCLES = 32;
+    localparam NUM_PERF = 33;
+
+    generate
+        if (PERF_COUNTERS) begin : perf
+            // FP32 / FP64 operands the incoming op reads, bit n = operand a, b, c;
+            // integer and 16-bit inputs are not classified
+            reg [2:0] in_sp, in_dp;
+            reg       in_ps;                // FP32x2, upper halves as well
+            always @(*) begin
+                in_sp = '0; in_dp = '0; in_ps = 1'b0;
                 case (func7)
-                    OP_FCVT_S_D: begin convert_input_type = FP64; convert_output_type = FP32; end
-                    OP_FCVT_W_D: begin convert_input_type = FP64; convert_output_type = (rs2[0]) ? UINT32 : INT32; end
-                    OP_FCVT_S_W: begin convert_input_type = (rs2[0]) ? UINT32 : INT32; convert_output_type = FP32; end
-                    default: begin convert_input_type = FP64; convert_output_type = FP32; end
+                    OP_FADD_S, OP_FSUB_S, OP_FMUL_S, OP_FDIV_S, OP_FCMP_S: in_sp = 3'b011;
+                    OP_FMADD_S, OP_FMSUB_S, OP_FNMSUB_S, OP_FNMADD_S:      in_sp = 3'b111;
+                    OP_FSQRT_S, OP_FCVT_D_S, OP_FCVT_W_S:                  in_sp = 3'b001;
+                    OP_FADD_PS, OP_FSUB_PS, OP_FMUL_PS, OP_FDIV_PS, OP_FCMP_PS,
+                    OP_FCVT_H4_S, OP_FCVT_B4_S:                            begin in_sp = 3'b011; in_ps = 1'b1; end
+                    OP_FCVT_W_PS:                                          begin in_sp = 3'b001; in_ps = 1'b1; end
+                    OP_FADD_D, OP_FSUB_D, OP_FMUL_D, OP_FDIV_D, OP_FCMP_D: in_dp = 3'b011;
+                    OP_FMADD_D, OP_FMSUB_D, OP_FNMSUB_D, OP_FNMADD_D:      in_dp = 3'b111;
+                    OP_FSQRT_D, OP_FCVT_S_D, OP_FCVT_W_D,
+                    OP_FCVT_H4_D, OP_FCVT_B4_D:                            in_dp = 3'b001;
+                    default: ;
                 endcase
             end
-            OP_FMUL_S: begin
-                result_out = {32'b0, sp_multiplier_result};
-                {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {sp_multiplier_invalid, sp_multiplier_overflow, sp_multiplier_underflow, sp_multiplier_inexact};
-            end
-            OP_FMUL_D: begin
-                result_out = dp_multiplier_result;
-                {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {dp_multiplier_invalid, dp_multiplier_overflow, dp_multiplier_underflow, dp_multiplier_inexact};
-            end
-            OP_FDIV_S: begin
-                result_out = {32'b0, sp_divider_result};
-                {flag_invalid, flag_divbyzero, flag_overflow, flag_underflow, flag_inexact} = {sp_divider_invalid, sp_divider_divbyzero, sp_divider_overflow, sp_divider_underflow, sp_divider_inexact};
-            end
-            OP_FDIV_D: begin
-                result_out = dp_divider_result;
-                {flag_invalid, flag_divbyzero, flag_overflow, flag_underflow, flag_inexact} = {dp_divider_invalid, dp_divider_divbyzero, dp_divider_overflow, dp_divider_underflow, dp_divider_inexact};
-            end
-            // OP_FDIV_S, OP_FDIV_D: begin
-            //     is_double = opcode[0];
-            //     result_out = divider_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {divider_invalid, divider_overflow, divider_underflow, divider_inexact};
-            // end
-            // OP_FSQRT_S, OP_FSQRT_D: begin
-            //     is_double = opcode[0];
-            //     result_out = sqrt_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {sqrt_invalid, sqrt_overflow, sqrt_underflow, sqrt_inexact};
-            // end
-            
-            // // --- Conversion Opcodes ---
-            // OP_FCVT_S_D: begin
-            //     convert_input_type = FP64;
-            //     convert_output_type = FP32;
-            //     result_out = convert_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {convert_invalid, convert_overflow, convert_underflow, convert_inexact};
-            // end
-            // OP_FCVT_D_S: begin
-            //     convert_input_type = FP32;
-            //     convert_output_type = FP64;
-            //     result_out = convert_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {convert_invalid, convert_overflow, convert_underflow, convert_inexact};
-            // end
-            // OP_FCVT_W_S: begin
-            //     is_double = 1'b0; // Op is on FP32
-            //     convert_input_type = FP32;
-            //     convert_output_type = INT32;
-            //     result_out = convert_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {convert_invalid, convert_overflow, convert_underflow, convert_inexact};
-            // end
-            // OP_FCVT_WU_S: begin
-            //     is_double = 1'b0; // Op is on FP32
-            //     convert_input_type = FP32;
-            //     convert_output_type = UINT32;
-            //     result_out = convert_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {convert_invalid, convert_overflow, convert_underflow, convert_inexact};
-            // end
-            // OP_FCVT_S_W: begin
-            //     is_double = 1'b0; // Result is FP32
-            //     convert_input_type = INT32;
-            //     convert_output_type = FP32;
-            //     result_out = convert_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {convert_invalid, convert_overflow, convert_underflow, convert_inexact};
-            // end
-            // OP_FCVT_S_WU: begin
-            //     is_double = 1'b0; // Result is FP32
-            //     convert_input_type = UINT32;
-            //     convert_output_type = FP32;
-            //     result_out = convert_result;
-            //     {flag_invalid, flag_overflow, flag_underflow, flag_inexact} = {convert_invalid, convert_overflow, convert_underflow, convert_inexact};
-            // end
-
-            default: begin
-                // Default to an invalid operation, return QNaN
-                result_out     = 64'h7FF8_0000_0000_0000; // Default QNaN
-                flag_invalid   = 1'b1;
+
+            wire [2:0] sp_denormal, sp_nan, dp_denormal, dp_nan;
+            wire [1:0] sp_hi_denormal, sp_hi_nan;
+            wire [63:0] in_operand [0:2];
+            assign in_operand[0] = operand_a;
+            assign in_operand[1] = operand_b;
+            assign in_operand[2] = operand_c;
+
+            for (genvar n = 0; n < 3; n++) begin : classify
+                wire       s_sign, d_sign;
+                wire [7:0] s_exp;
+                wire [10:0] d_exp;
+                wire [23:0] s_man;
+                wire [52:0] d_man;
+                wire       s_zero, s_inf, d_zero, d_inf;
+                SP_Decoder sp_dec ( .fp_in(in_operand[n][31:0]), .daz(1'b0), .sign_out(s_sign), .exponent_out(s_exp), .mantissa_out(s_man),
+                                    .is_zero(s_zero), .is_infinity(s_inf), .is_nan(sp_nan[n]), .is_denormal(sp_denormal[n]) );
+                DP_Decoder dp_dec ( .fp_in(in_operand[n]), .daz(1'b0), .sign_out(d_sign), .exponent_out(d_exp), .mantissa_out(d_man),
+                                    .is_zero(d_zero), .is_infinity(d_inf), .is_nan(dp_nan[n]), .is_denormal(dp_denormal[n]) );
+                if (n < 2) begin : hi
+                    wire       h_sign, h_zero, h_inf;
+                    wire [7:0] h_exp;
+                    wire [23:0] h_man;
+                    SP_Decoder sp_hi_dec ( .fp_in(in_operand[n][63:32]), .daz(1'b0), .sign_out(h_sign), .exponent_out(h_exp), .mantissa_out(h_man),
+                                           .is_zero(h_zero), .is_infinity(h_inf), .is_nan(sp_hi_nan[n]), .is_denormal(sp_hi_denormal[n]) );
+                end
             end
-        endcase
-    end
+
+            wire accept = in_valid && in_ready;
+            wire any_denormal = |(in_sp & sp_denormal) | (in_ps && |(in_sp[1:0] & sp_hi_denormal)) | |(in_dp & dp_denormal);
+            wire any_nan = |(in_sp & sp_nan) | (in_ps && |(in_sp[1:0] & sp_hi_nan)) | |(in_dp & dp_nan);
+
+            wire [NUM_PERF-1:0] perf_inc;
+            assign perf_inc[NUM_UNITS-1:0] = accept ? unit_sel : '0;
+            assign perf_inc[PERF_STALL] = in_valid && !in_ready;
+            assign perf_inc[PERF_BUSY + 0] = sp_divider_busy || sp_divider_hi_busy;
+            assign perf_inc[PERF_BUSY + 1] = dp_divider_busy;
+            assign perf_inc[PERF_BUSY + 2] = sp_sqrt_busy;
+            assign perf_inc[PERF_BUSY + 3] = dp_sqrt_busy;
+            assign perf_inc[PERF_DIV_WAIT] = d_valid && (d_unit[U_SP_DIV] || d_unit[U_DP_DIV]) && !d_fire;
+            assign perf_inc[PERF_FLAGS +: 5] = (|wb_grant) ? {wb_summary[0], wb_summary[1], wb_summary[2], wb_summary[3], wb_summary[4]} : 5'b0;
+            assign perf_inc[PERF_DENORMAL] = accept && any_denormal;
+            assign perf_inc[PERF_NAN] = accept && any_nan;
+            assign perf_inc[PERF_CYCLES] = 1'b1;
+
+            Perf_Counters #(.NUM(NUM_PERF), .WIDTH(64), .ADDR_W(6)) counters (
+                .clk(clk), .rst_n(rst_n),
+                .inc(perf_inc), .clear(perf_clear),
+                .addr(perf_addr), .rdata(perf_rdata)
+            );
+        end else begin : no_perf
+            assign perf_rdata = '0;
+        end
+    endgenerate
 
 endmodule
@@ -0,0 +1,165 @@
+module FP_Adder #(
+    parameter EXP_W = 8,
+    parameter MAN_W = 23,
+    parameter DUAL_PATH = 0,           // 1: near/far dual-path normalization, 0: single path
+    parameter STAGES = 0,              // Pipeline register between the add and the rounding (0-1)
+    parameter NARROW_EXP_W = EXP_W,    // Exponent width selected by narrow_exp (FP_Align_Round)
+    parameter NARROW_MAN_W = MAN_W,    // Result fraction bits selected by narrow_man
+    parameter DENORMALS = 1            // 0: FTZ / DAZ on every op, no denormal hardware
+) (
+    input           clk,
+    input           hold,               // Freeze the pipeline (result not taken)
+    input [EXP_W+MAN_W:0]   operand_a,
+    input [EXP_W+MAN_W:0]   operand_b,
+    input           is_subtraction,
+    input [2:0]     rounding_mode,
+    input           narrow_exp,         // Operands and result are a narrower format held in this one
+    input           narrow_man,
+    input           ftz,                // Denormal operands read as zero, tiny results flush to zero
+    output [EXP_W+MAN_W:0]  result,
+    output reg      flag_invalid,
+    output reg      flag_overflow,
+    output reg      flag_underflow,
+    output reg      flag_inexact,
+    output [15:0]   cov                 // Corner paths this op took, bin n on bit n (fpu_cov.h)
+);
+    localparam P = MAN_W + 1;           // mantissa with hidden bit
+
+    // --- Coverage bins ---
+    localparam CV_NAN = 0, CV_INF_INF = 1, CV_INF = 2, CV_ZERO = 3;
+    localparam CV_CANCEL = 4, CV_DENORM_IN = 5, CV_ALIGN_STICKY = 6, CV_ADD_CARRY = 7, CV_CANCEL_NORM = 8;
+    localparam CV_RNE_UP = 9;           // RNE, RDN, RUP, RMM rounded up: 9..12
+    localparam CV_ROUND_CARRY = 13, CV_OVERFLOW = 14, CV_UNDERFLOW = 15;
+    reg [15:0] cov_path, cov_round;     // set by the path and rounding blocks below
+    wire [15:0] r_cov_path;             // cov_path after the pipeline register
+    assign cov = r_cov_path | cov_round;
+
+    // operand a
+    reg sign_a_dec;
+    reg [EXP_W-1:0] exp_a_dec;
+    reg [P-1:0] mant_a_dec;
+    reg is_a_zero, is_a_infinity, is_a_nan, is_a_denormal;
+
+    // operand b
+    reg sign_b_dec;
+    reg [EXP_W-1:0] exp_b_dec;
+    reg [P-1:0] mant_b_dec;
+    reg is_b_zero, is_b_infinity, is_b_nan, is_b_denormal;
+
+    // result
+    reg final_sign;
+    reg [EXP_W-1:0] final_exp;
+    reg [P-1:0] final_mant;
+
+    // Decode / Encode
+    wire daz = ftz || !DENORMALS;
+    FP_Decoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) decoder_a ( .fp_in(operand_a), .daz(daz), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    FP_Decoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) decoder_b ( .fp_in(operand_b), .daz(daz), .sign_out(sign_b_dec), .exponent_out(exp_b_dec), .mantissa_out(mant_b_dec), .is_zero(is_b_zero), .is_infinity(is_b_infinity), .is_nan(is_b_nan), .is_denormal(is_b_denormal) );
+    FP_Encoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result) );
+
+    // --- 1. Special Value Handling ---
+    reg normal_path_enable;
+    reg eff_sign_b;
+    reg pre_sign;
+    reg [EXP_W-1:0] pre_exp;
+    reg [P-1:0] pre_mant;
+    reg pre_invalid;
+
+    // --- 2. Normal Path ---
+    // Both operands go to FP_Align_Round, the align / normalize / round block shared with the FMA,
+    // as P-bit significands; a denormal sits at exponent 1 without its hidden bit.
+    reg [EXP_W+1:0] exp_a, exp_b;
+
+    always @(*) begin
+        // init
+        pre_invalid=0;
+        pre_sign=0; pre_exp='0; pre_mant='0;
+        normal_path_enable=1;
+        cov_path='0;
+
+        // --- 1. Special Value Handling ---
+        eff_sign_b = sign_b_dec ^ is_subtraction; // e.g. a-(-b) = a+b
+        if (is_a_nan || is_b_nan) begin
+            normal_path_enable = 0;
+            pre_invalid = 1;
+            cov_path[CV_NAN] = 1;
+            pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, (P-2)'(0)}; // NAN
+        end else if (is_a_infinity) begin
+            normal_path_enable = 0;
+            if (is_b_infinity && sign_a_dec != eff_sign_b) begin
+                pre_invalid = 1;
+                cov_path[CV_INF_INF] = 1;
+                pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, (P-2)'(0)}; // NAN
+            end else begin
+                pre_sign = sign_a_dec; pre_exp = '1; pre_mant = '0; // INF
+                cov_path[CV_INF] = 1;
+            end
+        end else if (is_b_infinity) begin
+            normal_path_enable = 0;
+            pre_sign = eff_sign_b; pre_exp = '1; pre_mant = '0; // INF
+            cov_path[CV_INF] = 1;
+        end else if (is_a_zero && is_b_zero) begin
+            normal_path_enable = 0;
+            pre_sign = (sign_a_dec == eff_sign_b) ? sign_a_dec : (rounding_mode == 3'b010); pre_exp = '0; pre_mant = '0; // 0
+            cov_path[CV_ZERO] = 1;
+        end else if (is_a_zero) begin
+            normal_path_enable = 0;
+            pre_sign = eff_sign_b; pre_exp = exp_b_dec; pre_mant = mant_b_dec; // B
+            cov_path[CV_ZERO] = 1;
+        end else if (is_b_zero) begin
+            normal_path_enable = 0;
+            pre_sign = sign_a_dec; pre_exp = exp_a_dec; pre_mant = mant_a_dec; // A
+            cov_path[CV_ZERO] = 1;
+        end
+
+        cov_path[CV_DENORM_IN] = normal_path_enable & (is_a_denormal | is_b_denormal);
+
+        // --- 2. Normal Path ---
+        exp_a = is_a_denormal ? (EXP_W+2)'(1) : (EXP_W+2)'(exp_a_dec);
+        exp_b = is_b_denormal ? (EXP_W+2)'(1) : (EXP_W+2)'(exp_b_dec);
+    end
+
+    // --- 3-4. Align, add, normalize and round ---
+    // the special-case result travels through FP_Align_Round's pipeline register as sideband
+    localparam SIDE_W = 1 + 1 + EXP_W + P + 1 + 16;
+    wire r_normal, r_sign, r_invalid;
+    wire [EXP_W-1:0] r_pre_exp;
+    wire [P-1:0] r_pre_mant;
+    wire ar_sign;
+    wire [EXP_W-1:0] ar_exp;
+    wire [P-1:0] ar_mant;
+    wire ar_overflow, ar_underflow, ar_inexact;
+    wire [14:0] ar_cov;
+
+    FP_Align_Round #(.EXP_W(EXP_W), .MAN_W(MAN_W), .IN_W(P), .DUAL_PATH(DUAL_PATH), .STAGES(STAGES), .SIDE_W(SIDE_W),
+                     .NARROW_EXP_W(NARROW_EXP_W), .NARROW_MAN_W(NARROW_MAN_W), .DENORMALS(DENORMALS)) align_round (
+        .clk(clk), .hold(hold),
+        .sign_x(sign_a_dec), .exp_x(exp_a), .mant_x(mant_a_dec),
+        .sign_y(eff_sign_b), .exp_y(exp_b), .mant_y(mant_b_dec),
+        .rounding_mode(rounding_mode), .narrow_exp(narrow_exp), .narrow_man(narrow_man), .ftz(ftz),
+        .side_in({normal_path_enable, pre_sign, pre_exp, pre_mant, pre_invalid, cov_path}),
+        .side_out({r_normal, r_sign, r_pre_exp, r_pre_mant, r_invalid, r_cov_path}),
+        .sign_out(ar_sign), .exponent_out(ar_exp), .mantissa_out(ar_mant),
+        .flag_overflow(ar_overflow), .flag_underflow(ar_underflow), .flag_inexact(ar_inexact), .cov(ar_cov)
+    );
+
+    always @(*) begin
+        // init
+        flag_invalid=r_invalid; flag_overflow=0; flag_underflow=0; flag_inexact=0;
+        final_sign=r_sign; final_exp=r_pre_exp; final_mant=r_pre_mant;
+        cov_round='0;
+
+        if (r_normal) begin
+            flag_overflow = ar_overflow; flag_underflow = ar_underflow; flag_inexact = ar_inexact;
+            final_sign = ar_sign; final_exp = ar_exp; final_mant = ar_mant;
+            cov_round[CV_CANCEL] = ar_cov[13];
+            cov_round[CV_ALIGN_STICKY] = ar_cov[0];
+            cov_round[CV_ADD_CARRY] = ar_cov[2];
+            cov_round[CV_CANCEL_NORM] = ar_cov[14];
+            cov_round[CV_RNE_UP +: 4] = ar_cov[8:5];
+            cov_round[CV_ROUND_CARRY] = ar_cov[9];
+            cov_round[CV_OVERFLOW] = ar_cov[11] | ar_cov[12];
+            cov_round[CV_UNDERFLOW] = ar_underflow;
+        end
+    end
+endmodule
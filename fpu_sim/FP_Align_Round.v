@@ -0,0 +1,264 @@
+module FP_Align_Round #(
+    parameter EXP_W = 8,
+    parameter MAN_W = 23,
+    parameter IN_W = 2 * (MAN_W + 1),   // Operand significand width, bit IN_W-1 has the exponent
+    parameter DUAL_PATH = 0,            // 1: near/far dual-path normalization, 0: single path
+    parameter STAGES = 0,               // 1: pipeline register between the add and the rounding
+    parameter SIDE_W = 1,               // Sideband bits delayed alongside the sum
+    parameter NARROW_EXP_W = EXP_W,     // Exponent width selected by narrow_exp
+    parameter NARROW_MAN_W = MAN_W,     // Result fraction bits selected by narrow_man
+    parameter DENORMALS = 1             // 0: no denormal results, every op flushes as with ftz
+) (
+    input                       clk,
+    input                       hold,           // Keep the pipeline register (result not taken)
+    input                       sign_x,
+    input signed [EXP_W+1:0]    exp_x,          // Biased exponent of mant_x[IN_W-1], may be < 1
+    input [IN_W-1:0]            mant_x,
+    input                       sign_y,
+    input signed [EXP_W+1:0]    exp_y,
+    input [IN_W-1:0]            mant_y,
+    input [2:0]                 rounding_mode,
+    input                       narrow_exp,     // Overflow at the NARROW_EXP_W max normal
+    input                       narrow_man,     // Round to NARROW_MAN_W fraction bits, the rest stays 0
+    input                       ftz,            // Flush a tiny result to zero instead of the denormal shift
+    input  [SIDE_W-1:0]         side_in,
+    output [SIDE_W-1:0]         side_out,
+    output reg                  sign_out,
+    output reg [EXP_W-1:0]      exponent_out,
+    output reg [MAN_W:0]        mantissa_out,
+    output reg                  flag_overflow,
+    output reg                  flag_underflow,
+    output reg                  flag_inexact,
+    output [14:0]               cov             // Corner paths, AR_* bins below
+);
+    // x + y rounded once to EXP_W / MAN_W: the smaller operand is aligned below the larger with a
+    // sticky bit, the sum normalized, tiny results shifted to a denormal, then rounded with IEEE
+    // tininess after rounding and overflow to Inf or max normal by rounding mode.
+    // With narrow_exp / narrow_man the result is a narrower format held in this one: its exponent
+    // keeps its own bias in the same field, and its fraction is the top NARROW_MAN_W bits.
+    // With ftz a tiny result is a zero of its sign with UF and NX and skips the denormal shift;
+    // DENORMALS = 0 always flushes and so leaves the shifter out.
+    localparam P = MAN_W + 1;           // result mantissa with hidden bit
+    localparam SW = IN_W + 4;           // sum window: {carry, IN_W bits, guard, round, sticky}
+    localparam LSB = SW - 1 - P;        // result lsb in the normalized window
+    localparam LZ_S_W = $clog2(SW);
+    localparam DROP = MAN_W - NARROW_MAN_W; // fraction bits below the narrow_man rounding point
+
+    // --- Coverage bins ---
+    // 0..12 are in the order of the FMA's CV_ALIGN_STICKY..CV_OVERFLOW_MAX (fpu_cov.h)
+    localparam AR_ALIGN_STICKY = 0, AR_Y_LARGER = 1, AR_ADD_CARRY = 2, AR_TINY_CHECK = 3, AR_DENORM_OUT = 4;
+    localparam AR_RNE_UP = 5;           // RNE, RDN, RUP, RMM rounded up: 5..8
+    localparam AR_ROUND_CARRY = 9, AR_DENORM_TO_NORMAL = 10, AR_OVERFLOW_INF = 11, AR_OVERFLOW_MAX = 12;
+    localparam AR_CANCEL = 13, AR_NORM_SHIFT = 14;  // exact cancellation, normalized by more than one position
+    reg [14:0] cov_align, cov_round;    // set by the alignment and rounding blocks below
+    wire [14:0] r_cov_align;
+    assign cov = r_cov_align | cov_round;
+
+    // round-up decision shared by the normal-precision tininess check and the final rounding
+    function automatic round_inc(input [2:0] mode, input sign, input lsb, input g, input r, input s);
+        case (mode)
+            3'b000: round_inc = g & (lsb | r | s); // RNE
+            3'b001: round_inc = 1'b0; // RTZ
+            3'b010: round_inc = (g | r | s) & sign; // RDN
+            3'b011: round_inc = (g | r | s) & ~sign; // RUP
+            3'b100: round_inc = g; // RMM
+            default: round_inc = 1'b0;
+        endcase
+    endfunction
+
+    // {lsb, guard, round, sticky} of the normalized window, DROP positions higher with narrow_man
+    function automatic [3:0] grs(input [SW-1:0] m, input narrow);
+        if (narrow) grs = {m[LSB+DROP], m[LSB+DROP-1], m[LSB+DROP-2], |m[LSB+DROP-3:0]};
+        else        grs = {m[LSB], m[LSB-1], m[LSB-2], |m[LSB-3:0]};
+    endfunction
+
+    // --- 1. Alignment ---
+    reg pre_sign, cancel;
+    int exp_larger, exp_diff;
+    reg [SW-1:0] mant_larger, temp_smaller, mant_smaller, mant_sum;
+    reg s_align, eff_sub;
+
+    always @(*) begin
+        // init
+        pre_sign=0; cancel=0;
+        exp_larger=0; exp_diff=0;
+        mant_larger='0; temp_smaller='0; mant_smaller='0; mant_sum='0;
+        s_align=0; eff_sub=0;
+        cov_align='0;
+
+        if ((exp_x > exp_y) || ((exp_x == exp_y) && (mant_x >= mant_y))) begin
+            pre_sign = sign_x;
+            exp_larger = int'(exp_x);
+            exp_diff = int'(exp_x) - int'(exp_y);
+            mant_larger = {1'b0, mant_x, 3'b0};
+            temp_smaller = {1'b0, mant_y, 3'b0};
+        end else begin
+            pre_sign = sign_y;
+            exp_larger = int'(exp_y);
+            cov_align[AR_Y_LARGER] = 1;
+            exp_diff = int'(exp_y) - int'(exp_x);
+            mant_larger = {1'b0, mant_y, 3'b0};
+            temp_smaller = {1'b0, mant_x, 3'b0};
+        end
+        s_align = (exp_diff > SW-2) ? |temp_smaller : |(temp_smaller & ((SW'(1) << exp_diff) - 1));
+        cov_align[AR_ALIGN_STICKY] = s_align;
+        mant_smaller = ((exp_diff > SW-2) ? '0 : (temp_smaller >> exp_diff)) | {(SW-1)'(0), s_align};
+
+        // --- 2. Add / Subtract ---
+        eff_sub = (sign_x != sign_y);
+        if (eff_sub) mant_sum = mant_larger - mant_smaller; else mant_sum = mant_larger + mant_smaller;
+
+        if (mant_sum == 0) begin
+            pre_sign = (rounding_mode == 3'b010); cancel = 1; // exact cancellation
+            cov_align[AR_CANCEL] = 1;
+        end
+    end
+
+    // sum leading zeros (carry-out is handled in 3)
+    wire [LZ_S_W-1:0] lz_sum;
+    wire [SW-1:0] mant_sum_norm;
+
+    generate
+        if (DUAL_PATH) begin : dual_path
+            // Near path: effective subtraction with exponent difference <= 1, or a larger operand
+            // without its leading bit (two denormals, same exponent). Alignment is at most 1 bit and
+            // the leading zeros are anticipated from the operands alongside the subtraction,
+            // possibly one short.
+            wire near = (eff_sub && exp_diff <= 1) || !mant_larger[SW-2];
+            wire [SW-1:0] near_smaller = exp_diff[0] ? (temp_smaller >> 1) : temp_smaller;
+            wire [SW-1:0] near_sum = eff_sub ? (mant_larger - near_smaller) : (mant_larger + near_smaller);
+
+            // LZA on x + y, the subtraction carry-in folded in as an extra low position
+            wire [SW:0] lza_x = {mant_larger, eff_sub};
+            wire [SW:0] lza_y = eff_sub ? {~near_smaller, 1'b1} : {near_smaller, 1'b0};
+            wire [SW:0] lza_t = lza_x ^ lza_y, lza_g = lza_x & lza_y, lza_z = ~(lza_x | lza_y);
+            wire [SW:0] t_up = {1'b0, lza_t[SW:1]};
+            wire [SW:0] g_dn = {lza_g[SW-1:0], 1'b0}, z_dn = {lza_z[SW-1:0], 1'b1};
+            wire [SW:0] lza_f = (t_up & ((lza_g & ~z_dn) | (lza_z & ~g_dn))) | (~t_up & ((lza_z & ~z_dn) | (lza_g & ~g_dn)));
+
+            wire [LZ_S_W-1:0] near_shift;
+            wire [SW-1:0] near_shifted;
+
+            LZC #(.WIDTH(SW)) lza_count ( .data_in(lza_f[SW-1:0]), .count(near_shift) );
+            Barrel_Shifter #(.WIDTH(SW), .SHIFT_W(LZ_S_W)) near_shifter ( .data_in(near_sum), .shift_amt(near_shift), .shift_right(1'b0), .data_out(near_shifted) );
+
+            wire near_fix = !near_shifted[SW-2];
+
+            // Far path: the larger operand is normalized, so the sum is at most one position short
+            wire far_fix = !mant_sum[SW-2];
+
+            assign lz_sum = near ? (near_shift + LZ_S_W'(near_fix)) : LZ_S_W'(far_fix);
+            assign mant_sum_norm = near ? (near_fix ? (near_shifted << 1) : near_shifted)
+                                        : (far_fix ? (mant_sum << 1) : mant_sum);
+        end else begin : single_path
+            LZC #(.WIDTH(SW-1)) lzc_sum ( .data_in(mant_sum[SW-2:0]), .count(lz_sum) );
+            Barrel_Shifter #(.WIDTH(SW), .SHIFT_W(LZ_S_W)) norm_sum ( .data_in(mant_sum), .shift_amt(lz_sum), .shift_right(1'b0), .data_out(mant_sum_norm) );
+        end
+    endgenerate
+
+    // --- Pipeline register ---
+    // With STAGES = 1 the sum, its leading-zero count and normalized copy are registered, and
+    // the rounding runs in the next cycle; side_in (the caller's special-case result), the
+    // rounding mode, the format select and ftz travel alongside.
+    localparam R_W = 1 + 1 + 32 + SW + LZ_S_W + SW + 3 + 3 + 15 + SIDE_W;
+    wire [R_W-1:0] r_d = {pre_sign, cancel, exp_larger, mant_sum, lz_sum, mant_sum_norm, rounding_mode, narrow_exp, narrow_man, ftz, cov_align, side_in};
+    reg  [R_W-1:0] r_q;
+
+    generate
+        if (STAGES == 0) begin : comb
+            always @(*) r_q = r_d;
+        end else begin : stage
+            always @(posedge clk) begin
+                if (!hold) r_q <= r_d;
+            end
+        end
+    endgenerate
+
+    wire r_pre_sign, r_cancel;
+    wire signed [31:0] r_exp_larger;
+    wire [SW-1:0] r_mant_sum, r_mant_sum_norm;
+    wire [LZ_S_W-1:0] r_lz_sum;
+    wire [2:0] r_rounding_mode;
+    wire r_narrow_exp, r_narrow_man, r_ftz;
+    assign {r_pre_sign, r_cancel, r_exp_larger, r_mant_sum, r_lz_sum, r_mant_sum_norm, r_rounding_mode, r_narrow_exp, r_narrow_man, r_ftz, r_cov_align, side_out} = r_q;
+    wire flush = r_ftz || !DENORMALS;
+
+    // largest finite exponent and the fraction bits the result may use
+    wire [EXP_W-1:0] exp_max_normal = r_narrow_exp ? EXP_W'((1 << NARROW_EXP_W) - 2) : EXP_W'((1 << EXP_W) - 2);
+    wire [P-1:0] man_keep = r_narrow_man ? ({P{1'b1}} << DROP) : '1;
+
+    // --- 3-7. Normalize and Round ---
+    // mant_norm: leading 1 at SW-2, result mantissa [SW-2:LSB], guard LSB-1, round LSB-2, sticky below
+    int exp_norm;
+    reg [SW-1:0] mant_norm;
+    reg [P:0] mant_round;
+    reg lsb, g_bit, r_bit, s_bit, round_up, tiny;
+
+    always @(*) begin
+        // init
+        flag_overflow=0; flag_underflow=0; flag_inexact=0;
+        sign_out=r_pre_sign; exponent_out='0; mantissa_out='0;
+        exp_norm=r_exp_larger; mant_norm=r_mant_sum; mant_round='0;
+        lsb=0; g_bit=0; r_bit=0; s_bit=0; round_up=0; tiny=0;
+        cov_round='0;
+
+        if (!r_cancel) begin
+            // --- 3. Normalize to bit SW-2 ---
+            if (r_mant_sum[SW-1]) begin // Addition overflow
+                mant_norm = {1'b0, r_mant_sum[SW-1:2], r_mant_sum[1] | r_mant_sum[0]}; exp_norm += 1;
+                cov_round[AR_ADD_CARRY] = 1;
+            end else begin
+                mant_norm = r_mant_sum_norm; exp_norm -= int'(r_lz_sum);
+                cov_round[AR_NORM_SHIFT] = (r_lz_sum > 1);
+            end
+
+            // --- 4. Tininess (after rounding, unbounded exponent) ---
+            tiny = (exp_norm < 1);
+            if (exp_norm == 0 && (&(mant_norm[SW-2:LSB] | ~man_keep))) begin
+                cov_round[AR_TINY_CHECK] = 1;
+                {lsb, g_bit, r_bit, s_bit} = grs(mant_norm, r_narrow_man);
+                tiny = !round_inc(r_rounding_mode, sign_out, lsb, g_bit, r_bit, s_bit);
+            end
+
+            // --- 5. Denormal shift (tiny results flush in 7 instead) ---
+            if (exp_norm < 1 && !flush) begin
+                cov_round[AR_DENORM_OUT] = 1;
+                if (1 - exp_norm > SW-2) begin
+                    mant_norm = {(SW-1)'(0), |mant_norm};
+                end else begin
+                    s_bit = |(mant_norm & ((SW'(1) << (1 - exp_norm)) - 1));
+                    mant_norm = (mant_norm >> (1 - exp_norm)) | {(SW-1)'(0), s_bit};
+                end
+                exp_norm = 0;
+            end
+
+            // --- 6. Rounding ---
+            {lsb, g_bit, r_bit, s_bit} = grs(mant_norm, r_narrow_man);
+            flag_inexact = g_bit | r_bit | s_bit;
+            round_up = round_inc(r_rounding_mode, sign_out, lsb, g_bit, r_bit, s_bit);
+            cov_round[AR_RNE_UP +: 4] = round_up ? {r_rounding_mode == 3'b100, r_rounding_mode == 3'b011, r_rounding_mode == 3'b010, r_rounding_mode == 3'b000} : 4'b0;
+            mant_round = {1'b0, mant_norm[SW-2:LSB] & man_keep} + ((P+1)'(round_up) << (r_narrow_man ? DROP : 0));
+            if (mant_round[P]) begin mant_round >>= 1; exp_norm += 1; cov_round[AR_ROUND_CARRY] = 1; end
+            if (exp_norm == 0 && mant_round[P-1] && !flush) begin exp_norm = 1; cov_round[AR_DENORM_TO_NORMAL] = 1; end // denormal rounded up to min normal
+
+            // --- 7. OF / UF ---
+            if (exp_norm > int'(exp_max_normal)) begin
+                flag_overflow = 1; flag_inexact = 1;
+                if (r_rounding_mode == 3'b001 || (r_rounding_mode == 3'b010 && !sign_out) || (r_rounding_mode == 3'b011 && sign_out)) begin
+                    exponent_out = exp_max_normal; mantissa_out = man_keep; // max normal
+                    cov_round[AR_OVERFLOW_MAX] = 1;
+                end else begin
+                    exponent_out = '1; mantissa_out = '0; // Inf
+                    cov_round[AR_OVERFLOW_INF] = 1;
+                end
+            end else if (flush && tiny) begin
+                flag_underflow = 1; flag_inexact = 1;
+                exponent_out = '0; mantissa_out = '0; // zero of the result's sign
+            end else begin
+                flag_underflow = tiny & flag_inexact;
+                exponent_out = exp_norm[EXP_W-1:0];
+                mantissa_out = mant_round[P-1:0];
+            end
+        end
+    end
+endmodule
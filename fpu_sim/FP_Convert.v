@@ -0,0 +1,186 @@
+module FP_Convert #(
+    parameter IN_EXP_W = 8,
+    parameter IN_MAN_W = 23,
+    parameter OUT_EXP_W = 5,
+    parameter OUT_MAN_W = 10,
+    parameter IN_NARROW_EXP_W = IN_EXP_W,   // Input exponent width (own bias) selected by narrow_exp
+    parameter OUT_NARROW_EXP_W = OUT_EXP_W, // Output exponent width selected by narrow_exp
+    parameter OUT_NARROW_MAN_W = OUT_MAN_W, // Output fraction bits selected by narrow_man
+    parameter DENORMALS = 1                 // 0: FTZ / DAZ on every op, no denormal normalize or shift
+) (
+    input [IN_EXP_W+IN_MAN_W:0]     operand_in,
+    input [2:0]                     rounding_mode,
+    input                           narrow_exp,     // A narrower format is held in the input / output format
+    input                           narrow_man,
+    input                           ftz,            // Denormal input reads as zero, tiny result flushes to zero
+    output [OUT_EXP_W+OUT_MAN_W:0]  result,
+    output reg      flag_invalid,
+    output reg      flag_overflow,
+    output reg      flag_underflow,
+    output reg      flag_inexact,
+    output reg [13:0]   cov             // Corner paths this op took, bin n on bit n (fpu_cov.h)
+);
+    // Float to float in either direction. Widening is exact (a narrow denormal can stay a
+    // denormal when the exponent does not widen, e.g. BF16 -> FP32); narrowing rounds once.
+    // narrow_exp / narrow_man select a narrower format held in the same bits, as in FP_Align_Round:
+    // its exponent keeps its own bias in the same field, its fraction is the top bits.
+    localparam IN_P = IN_MAN_W + 1;
+    localparam OUT_P = OUT_MAN_W + 1;
+    localparam IN_BIAS = (1 << (IN_EXP_W - 1)) - 1;
+    localparam OUT_BIAS = (1 << (OUT_EXP_W - 1)) - 1;
+    localparam IN_NARROW_BIAS = (1 << (IN_NARROW_EXP_W - 1)) - 1;
+    localparam OUT_NARROW_BIAS = (1 << (OUT_NARROW_EXP_W - 1)) - 1;
+    localparam DROP = OUT_MAN_W - OUT_NARROW_MAN_W; // output fraction bits below the narrow_man rounding point
+    localparam LZ_W = $clog2(IN_P + 1);
+    // {OUT_P result bits, guard, round, sticky} with room for every input bit above sticky
+    localparam WORK_W = ((IN_P > OUT_P) ? IN_P : OUT_P) + 3;
+    localparam LSB = WORK_W - OUT_P;    // result lsb in mant_work
+
+    // --- Coverage bins ---
+    localparam CV_NAN = 0, CV_INF = 1, CV_ZERO = 2, CV_DENORM_IN = 3, CV_TINY_CHECK = 4, CV_DENORM_OUT = 5;
+    localparam CV_RNE_UP = 6;           // RNE, RDN, RUP, RMM rounded up: 6..9
+    localparam CV_ROUND_CARRY = 10, CV_OVERFLOW_INF = 11, CV_OVERFLOW_MAX = 12, CV_UNDERFLOW = 13;
+
+    // operand
+    reg sign_a_dec;
+    reg [IN_EXP_W-1:0] exp_a_dec;
+    reg [IN_P-1:0] mant_a_dec;
+    reg is_a_zero, is_a_infinity, is_a_nan, is_a_denormal;
+
+    // result
+    reg final_sign;
+    reg [OUT_EXP_W-1:0] final_exp;
+    reg [OUT_P-1:0] final_mant;
+
+    // Decode / Encode
+    wire flush = ftz || !DENORMALS;
+    FP_Decoder #(.EXP_W(IN_EXP_W), .MAN_W(IN_MAN_W)) decoder_a ( .fp_in(operand_in), .daz(flush), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    FP_Encoder #(.EXP_W(OUT_EXP_W), .MAN_W(OUT_MAN_W)) encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result) );
+
+    // round-up decision shared by the tininess check and the final rounding
+    function automatic round_inc(input [2:0] mode, input sign, input lsb, input g, input r, input s);
+        case (mode)
+            3'b000: round_inc = g & (lsb | r | s); // RNE
+            3'b001: round_inc = 1'b0; // RTZ
+            3'b010: round_inc = (g | r | s) & sign; // RDN
+            3'b011: round_inc = (g | r | s) & ~sign; // RUP
+            3'b100: round_inc = g; // RMM
+            default: round_inc = 1'b0;
+        endcase
+    endfunction
+
+    // {lsb, guard, round, sticky} of mant_work, DROP positions higher with narrow_man
+    function automatic [3:0] grs(input [WORK_W-1:0] m, input narrow);
+        if (narrow) grs = {m[LSB+DROP], m[LSB+DROP-1], m[LSB+DROP-2], |m[LSB+DROP-3:0]};
+        else        grs = {m[LSB], m[LSB-1], m[LSB-2], |m[LSB-3:0]};
+    endfunction
+
+    // format of the input and output: biases, largest finite output exponent and output fraction bits
+    wire [OUT_EXP_W-1:0] exp_max_normal = narrow_exp ? OUT_EXP_W'((1 << OUT_NARROW_EXP_W) - 2) : OUT_EXP_W'((1 << OUT_EXP_W) - 2);
+    wire [OUT_P-1:0] man_keep = narrow_man ? ({OUT_P{1'b1}} << DROP) : '1;
+    wire signed [31:0] rebias = narrow_exp ? OUT_NARROW_BIAS - IN_NARROW_BIAS : OUT_BIAS - IN_BIAS;
+
+    // --- Denormal pre-normalization ---
+    // without DENORMALS the input never decodes as a denormal
+    wire [LZ_W-1:0] lz_a;
+    wire [IN_P-1:0] mant_a_norm;
+
+    generate
+        if (DENORMALS) begin : denorm_in
+            LZC #(.WIDTH(IN_P)) lzc_a ( .data_in(mant_a_dec), .count(lz_a) );
+            Barrel_Shifter #(.WIDTH(IN_P), .SHIFT_W(LZ_W)) norm_a ( .data_in(mant_a_dec), .shift_amt(lz_a), .shift_right(1'b0), .data_out(mant_a_norm) );
+        end else begin : no_denorm_in
+            assign lz_a = '0;
+            assign mant_a_norm = mant_a_dec;
+        end
+    endgenerate
+
+    reg normal_path_enable;
+    int exp_norm;
+    reg [WORK_W-1:0] mant_work;
+    reg [OUT_P:0] mant_round;
+    reg lsb, g_bit, r_bit, s_bit, round_up, tiny;
+
+    always @(*) begin
+        // init
+        flag_invalid = 0; flag_overflow = 0; flag_underflow = 0; flag_inexact = 0;
+        normal_path_enable = 1;
+        final_sign = sign_a_dec; final_exp = '0; final_mant = '0;
+        exp_norm = 0; mant_work = '0; mant_round = '0;
+        lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0; tiny = 0;
+        cov = '0;
+
+        // --- 1. Special Value Handling ---
+        if (is_a_nan) begin
+            normal_path_enable = 0;
+            flag_invalid = 1;
+            final_sign = 0; final_exp = '1; final_mant = {2'b11, (OUT_P-2)'(0)}; // NaN
+            cov[CV_NAN] = 1;
+        end else if (is_a_infinity) begin
+            normal_path_enable = 0;
+            final_exp = '1; final_mant = '0; // Inf
+            cov[CV_INF] = 1;
+        end else if (is_a_zero) begin
+            normal_path_enable = 0;
+            final_exp = '0; final_mant = '0; // 0
+            cov[CV_ZERO] = 1;
+        end
+        cov[CV_DENORM_IN] = is_a_denormal;
+
+        // --- 2. Normal Path ---
+        if (normal_path_enable) begin
+            // --- 2a. Rebias, mantissa left-aligned with its leading 1 at the top ---
+            exp_norm = (is_a_denormal ? 1 : int'(exp_a_dec)) - int'(lz_a) + rebias;
+            mant_work = {mant_a_norm, (WORK_W-IN_P)'(0)};
+
+            // --- 2b. Tininess (after rounding, unbounded exponent) ---
+            tiny = (exp_norm < 1);
+            if (exp_norm == 0 && (&(mant_work[WORK_W-1 -: OUT_P] | ~man_keep))) begin
+                cov[CV_TINY_CHECK] = 1;
+                {lsb, g_bit, r_bit, s_bit} = grs(mant_work, narrow_man);
+                tiny = !round_inc(rounding_mode, sign_a_dec, lsb, g_bit, r_bit, s_bit);
+            end
+
+            // --- 2c. Denormal shift (tiny results flush in 2e instead) ---
+            if (exp_norm < 1 && !flush) begin
+                cov[CV_DENORM_OUT] = 1;
+                if (1 - exp_norm > WORK_W-1) begin
+                    mant_work = {(WORK_W-1)'(0), |mant_work};
+                end else begin
+                    s_bit = |(mant_work & ((WORK_W'(1) << (1 - exp_norm)) - 1));
+                    mant_work = (mant_work >> (1 - exp_norm)) | {(WORK_W-1)'(0), s_bit};
+                end
+                exp_norm = 0;
+            end
+
+            // --- 2d. Rounding ---
+            {lsb, g_bit, r_bit, s_bit} = grs(mant_work, narrow_man);
+            flag_inexact = g_bit | r_bit | s_bit;
+            round_up = round_inc(rounding_mode, sign_a_dec, lsb, g_bit, r_bit, s_bit);
+            cov[CV_RNE_UP +: 4] = round_up ? {rounding_mode == 3'b100, rounding_mode == 3'b011, rounding_mode == 3'b010, rounding_mode == 3'b000} : 4'b0;
+            mant_round = {1'b0, mant_work[WORK_W-1 -: OUT_P] & man_keep} + ((OUT_P+1)'(round_up) << (narrow_man ? DROP : 0));
+            if (mant_round[OUT_P]) begin mant_round >>= 1; exp_norm += 1; cov[CV_ROUND_CARRY] = 1; end
+            if (exp_norm == 0 && mant_round[OUT_P-1] && !flush) exp_norm = 1; // denormal rounded up to min normal
+
+            // --- 2e. OF / UF ---
+            if (exp_norm > int'(exp_max_normal)) begin
+                flag_overflow = 1; flag_inexact = 1;
+                if (rounding_mode == 3'b001 || (rounding_mode == 3'b010 && !sign_a_dec) || (rounding_mode == 3'b011 && sign_a_dec)) begin
+                    final_exp = exp_max_normal; final_mant = man_keep; // max normal
+                    cov[CV_OVERFLOW_MAX] = 1;
+                end else begin
+                    final_exp = '1; final_mant = '0; // Inf
+                    cov[CV_OVERFLOW_INF] = 1;
+                end
+            end else if (flush && tiny) begin
+                flag_underflow = 1; flag_inexact = 1;
+                final_exp = '0; final_mant = '0; // zero of the input's sign
+            end else begin
+                flag_underflow = tiny & flag_inexact;
+                final_exp = exp_norm[OUT_EXP_W-1:0];
+                final_mant = mant_round[OUT_P-1:0];
+            end
+            cov[CV_UNDERFLOW] = flag_underflow;
+        end
+    end
+endmodule
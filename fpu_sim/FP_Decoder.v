@@ -0,0 +1,36 @@
+module FP_Decoder #(
+    parameter EXP_W = 8,
+    parameter MAN_W = 23                // Stored fraction bits, the hidden bit is added on decode
+) (
+    input  [EXP_W+MAN_W:0] fp_in,
+    input  daz,                         // 1: a denormal decodes as a zero of the same sign
+
+    // decode
+    output sign_out,
+    output [EXP_W-1:0] exponent_out,
+    output [MAN_W:0] mantissa_out,
+
+    // Flags for identifying the number type
+    output is_zero,
+    output is_infinity,
+    output is_nan,
+    output is_denormal
+);
+
+    // intermediate logic
+    wire is_exp_max = (fp_in[EXP_W+MAN_W-1:MAN_W] == {EXP_W{1'b1}});
+    wire is_exp_zero = (fp_in[EXP_W+MAN_W-1:MAN_W] == 0);
+    wire is_mant_zero = (fp_in[MAN_W-1:0] == 0);
+
+    // set flag
+    assign is_zero      = is_exp_zero && (is_mant_zero || daz);
+    assign is_infinity  = is_exp_max  && is_mant_zero;
+    assign is_nan       = is_exp_max  && !is_mant_zero;
+    assign is_denormal  = is_exp_zero && !is_mant_zero && !daz;
+
+    // decoded parts
+    assign sign_out = fp_in[EXP_W+MAN_W];
+    assign exponent_out = fp_in[EXP_W+MAN_W-1:MAN_W];
+    assign mantissa_out = (is_denormal) ?{1'b0, fp_in[MAN_W-1:0]} : (is_zero) ?{1'b1, MAN_W'(0)} :{1'b1, fp_in[MAN_W-1:0]};
+
+endmodule
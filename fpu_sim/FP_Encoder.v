@@ -0,0 +1,11 @@
+module FP_Encoder #(
+    parameter EXP_W = 8,
+    parameter MAN_W = 23
+) (
+    input                   sign_in,
+    input  [EXP_W-1:0]      exponent_in,
+    input  [MAN_W:0]        mantissa_in,
+    output [EXP_W+MAN_W:0]  fp_out
+);
+    assign fp_out = {sign_in, exponent_in, mantissa_in[MAN_W-1:0]};
+endmodule
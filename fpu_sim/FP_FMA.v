@@ -0,0 +1,233 @@
+module FP_FMA #(
+    parameter EXP_W = 8,
+    parameter MAN_W = 23,
+    parameter STAGES = 0,               // Pipeline registers (0-4): the product tree, then the rounding
+    parameter NARROW_EXP_W = EXP_W,     // Exponent width (own bias) selected by narrow_exp
+    parameter NARROW_MAN_W = MAN_W,     // Result fraction bits selected by narrow_man
+    parameter DENORMALS = 1             // 0: FTZ / DAZ on every op, no denormal normalize or shift
+) (
+    input           clk,
+    input           hold,               // Freeze the pipeline (result not taken)
+    input [EXP_W+MAN_W:0]   operand_a,
+    input [EXP_W+MAN_W:0]   operand_b,
+    input [EXP_W+MAN_W:0]   operand_c,
+    input           negate_product,     // -(a*b), FNMADD / FNMSUB
+    input           negate_addend,      // -c, FMSUB / FNMADD
+    input [2:0]     rounding_mode,
+    input           narrow_exp,         // Operands and result are a narrower format held in this one
+    input           narrow_man,         // (FP_Align_Round)
+    input           ftz,                // Denormal operands read as zero, tiny results flush to zero
+    output [EXP_W+MAN_W:0]  result,
+    output reg      flag_invalid,
+    output reg      flag_overflow,
+    output reg      flag_underflow,
+    output reg      flag_inexact,
+    output [17:0]   cov                 // Corner paths this op took, bin n on bit n (fpu_cov.h)
+);
+    // --- Coverage bins ---
+    localparam CV_INVALID = 0, CV_INF = 1, CV_ZERO_PRODUCT = 2, CV_CANCEL = 3, CV_DENORM_IN = 4;
+    localparam CV_ALIGN_STICKY = 5, CV_ADDEND_LARGER = 6, CV_ADD_CARRY = 7, CV_TINY_CHECK = 8, CV_DENORM_OUT = 9;
+    localparam CV_RNE_UP = 10;          // RNE, RDN, RUP, RMM rounded up: 10..13
+    localparam CV_ROUND_CARRY = 14, CV_DENORM_TO_NORMAL = 15, CV_OVERFLOW_INF = 16, CV_OVERFLOW_MAX = 17;
+    reg [17:0] cov_path, cov_round;     // set by the path and rounding blocks below
+    wire [17:0] r_cov_path;             // cov_path after the pipeline registers
+    assign cov = r_cov_path | cov_round;
+
+    // STAGES registers: the first goes into the Booth tree, the second between the add and the
+    // rounding in FP_Align_Round, any further ones back into the tree
+    localparam AR_STAGES = (STAGES >= 2) ? 1 : 0;
+    localparam MUL_STAGES = STAGES - AR_STAGES;
+
+    localparam P = MAN_W + 1;           // mantissa with hidden bit
+    localparam BIAS = (1 << (EXP_W - 1)) - 1;
+    localparam NARROW_BIAS = (1 << (NARROW_EXP_W - 1)) - 1;
+    localparam PW = 2 * P;              // product width
+    localparam LZ_C_W = $clog2(P + 1);
+    localparam LZ_P_W = $clog2(PW + 1);
+
+    // operand a
+    reg sign_a_dec;
+    reg [EXP_W-1:0] exp_a_dec;
+    reg [P-1:0] mant_a_dec;
+    reg is_a_zero, is_a_infinity, is_a_nan, is_a_denormal;
+
+    // operand b
+    reg sign_b_dec;
+    reg [EXP_W-1:0] exp_b_dec;
+    reg [P-1:0] mant_b_dec;
+    reg is_b_zero, is_b_infinity, is_b_nan, is_b_denormal;
+
+    // operand c
+    reg sign_c_dec;
+    reg [EXP_W-1:0] exp_c_dec;
+    reg [P-1:0] mant_c_dec;
+    reg is_c_zero, is_c_infinity, is_c_nan, is_c_denormal;
+
+    // result
+    reg final_sign;
+    reg [EXP_W-1:0] final_exp;
+    reg [P-1:0] final_mant;
+
+    // Decode / Encode
+    wire daz = ftz || !DENORMALS;
+    FP_Decoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) decoder_a ( .fp_in(operand_a), .daz(daz), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    FP_Decoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) decoder_b ( .fp_in(operand_b), .daz(daz), .sign_out(sign_b_dec), .exponent_out(exp_b_dec), .mantissa_out(mant_b_dec), .is_zero(is_b_zero), .is_infinity(is_b_infinity), .is_nan(is_b_nan), .is_denormal(is_b_denormal) );
+    FP_Decoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) decoder_c ( .fp_in(operand_c), .daz(daz), .sign_out(sign_c_dec), .exponent_out(exp_c_dec), .mantissa_out(mant_c_dec), .is_zero(is_c_zero), .is_infinity(is_c_infinity), .is_nan(is_c_nan), .is_denormal(is_c_denormal) );
+    FP_Encoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result) );
+
+    // --- 1. Special Value Handling ---
+    reg normal_path_enable;
+    reg sign_prod, eff_sign_c;
+    reg pre_sign;
+    reg [EXP_W-1:0] pre_exp;
+    reg [P-1:0] pre_mant;
+    reg pre_invalid;
+
+    // --- 2. Normal Path ---
+    // The exact PW-bit product and the addend are both normalized to the top bit and handed to
+    // the shared align / normalize / round block FP_Align_Round as two PW-bit operands.
+    int exp_prod_base, exp_c;
+    reg [P-1:0] mant_c_top;             // addend significand, PW bits with P zeros below
+
+    // addend leading zeros, none without DENORMALS
+    wire [LZ_C_W-1:0] lz_c;
+    wire [P-1:0] mant_c_norm;
+
+    generate
+        if (DENORMALS) begin : denorm_c
+            LZC #(.WIDTH(P)) lzc_c ( .data_in(mant_c_dec), .count(lz_c) );
+            Barrel_Shifter #(.WIDTH(P), .SHIFT_W(LZ_C_W)) norm_c ( .data_in(mant_c_dec), .shift_amt(lz_c), .shift_right(1'b0), .data_out(mant_c_norm) );
+        end else begin : no_denorm_c
+            assign lz_c = '0;
+            assign mant_c_norm = mant_c_dec;
+        end
+    endgenerate
+
+    always @(*) begin
+        // init
+        pre_invalid=0;
+        pre_sign=0; pre_exp='0; pre_mant='0;
+        normal_path_enable=1;
+        cov_path='0;
+
+        // --- 1. Special Value Handling ---
+        sign_prod = sign_a_dec ^ sign_b_dec ^ negate_product;
+        eff_sign_c = sign_c_dec ^ negate_addend;
+        if (is_a_nan || is_b_nan || is_c_nan) begin
+            normal_path_enable = 0;
+            pre_invalid = 1;
+            pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, (P-2)'(0)}; // NAN
+        end else if ((is_a_infinity && is_b_zero) || (is_a_zero && is_b_infinity)) begin
+            normal_path_enable = 0;
+            pre_invalid = 1;
+            pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, (P-2)'(0)}; // NAN
+        end else if (is_a_infinity || is_b_infinity) begin
+            normal_path_enable = 0;
+            if (is_c_infinity && sign_prod != eff_sign_c) begin
+                pre_invalid = 1;
+                pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, (P-2)'(0)}; // NAN
+            end else begin
+                pre_sign = sign_prod; pre_exp = '1; pre_mant = '0; // INF
+                cov_path[CV_INF] = 1;
+            end
+        end else if (is_c_infinity) begin
+            normal_path_enable = 0;
+            pre_sign = eff_sign_c; pre_exp = '1; pre_mant = '0; // INF
+            cov_path[CV_INF] = 1;
+        end else if (is_a_zero || is_b_zero) begin
+            normal_path_enable = 0;
+            cov_path[CV_ZERO_PRODUCT] = 1;
+            if (is_c_zero) begin
+                pre_sign = (sign_prod == eff_sign_c) ? sign_prod : (rounding_mode == 3'b010); pre_exp = '0; pre_mant = '0; // 0
+            end else begin
+                pre_sign = eff_sign_c; pre_exp = exp_c_dec; pre_mant = mant_c_dec; // C
+            end
+        end
+        cov_path[CV_INVALID] = pre_invalid;
+        cov_path[CV_DENORM_IN] = normal_path_enable & (is_a_denormal | is_b_denormal | is_c_denormal);
+
+        // --- 2a. Product exponent, before the product's own leading zeros ---
+        exp_prod_base = (is_a_denormal ? 1 : int'(exp_a_dec)) + (is_b_denormal ? 1 : int'(exp_b_dec)) - ((narrow_exp ? NARROW_BIAS : BIAS) - 1);
+
+        // --- 2b. Addend --- (a zero addend sits below every product, so it only ever aligns away)
+        mant_c_top = '0; exp_c = -(1 << (EXP_W + 1));
+        if (!is_c_zero) begin
+            mant_c_top = mant_c_norm;
+            exp_c = (is_c_denormal ? 1 : int'(exp_c_dec)) - int'(lz_c);
+        end
+    end
+
+    // --- 2c. Product (Booth tree, full width) ---
+    // everything after the product travels with it through the tree's pipeline registers as m_*
+    localparam M_SIDE_W = 1 + 1 + 1 + 1 + EXP_W + P + 1 + 32 + 32 + P + 3 + 3 + 18;
+    wire m_normal, m_sign_prod, m_eff_sign_c, m_pre_sign, m_pre_invalid;
+    wire [EXP_W-1:0] m_pre_exp;
+    wire [P-1:0] m_pre_mant, m_mant_c_top;
+    wire signed [31:0] m_exp_prod_base, m_exp_c;
+    wire [2:0] m_rounding_mode;
+    wire m_narrow_exp, m_narrow_man, m_ftz;
+    wire [17:0] m_cov_path;
+    wire [PW-1:0] mant_prod_raw;
+
+    Booth_Multiplier #(.WIDTH(P), .STAGES(MUL_STAGES), .LOW_BITS(0), .SIDE_W(M_SIDE_W)) booth_mul (
+        .clk(clk), .hold(hold),
+        .mant_a(mant_a_dec), .mant_b(mant_b_dec),
+        .side_in({normal_path_enable, sign_prod, eff_sign_c, pre_sign, pre_exp, pre_mant, pre_invalid, exp_prod_base, exp_c, mant_c_top, rounding_mode, narrow_exp, narrow_man, ftz, cov_path}),
+        .product_hi(mant_prod_raw), .sticky(),
+        .side_out({m_normal, m_sign_prod, m_eff_sign_c, m_pre_sign, m_pre_exp, m_pre_mant, m_pre_invalid, m_exp_prod_base, m_exp_c, m_mant_c_top, m_rounding_mode, m_narrow_exp, m_narrow_man, m_ftz, m_cov_path})
+    );
+
+    // product leading zeros; of two normal significands the product is in [1, 4), so at most one
+    wire [LZ_P_W-1:0] lz_prod;
+    wire [PW-1:0] mant_prod_norm;
+
+    generate
+        if (DENORMALS) begin : denorm_prod
+            LZC #(.WIDTH(PW)) lzc_prod ( .data_in(mant_prod_raw), .count(lz_prod) );
+            Barrel_Shifter #(.WIDTH(PW), .SHIFT_W(LZ_P_W)) norm_prod ( .data_in(mant_prod_raw), .shift_amt(lz_prod), .shift_right(1'b0), .data_out(mant_prod_norm) );
+        end else begin : no_denorm_prod
+            assign lz_prod = LZ_P_W'(!mant_prod_raw[PW-1]);
+            assign mant_prod_norm = mant_prod_raw[PW-1] ? mant_prod_raw : (mant_prod_raw << 1);
+        end
+    endgenerate
+
+    wire signed [31:0] exp_prod = m_exp_prod_base - int'(lz_prod);
+
+    // --- 2d-2i. Align, add, normalize and round ---
+    // the special-case result goes on through FP_Align_Round's pipeline register as r_*
+    localparam R_SIDE_W = 1 + 1 + EXP_W + P + 1 + 18;
+    wire r_normal, r_pre_sign, r_pre_invalid;
+    wire [EXP_W-1:0] r_pre_exp;
+    wire [P-1:0] r_pre_mant;
+    wire ar_sign;
+    wire [EXP_W-1:0] ar_exp;
+    wire [P-1:0] ar_mant;
+    wire ar_overflow, ar_underflow, ar_inexact;
+    wire [14:0] ar_cov;
+
+    FP_Align_Round #(.EXP_W(EXP_W), .MAN_W(MAN_W), .IN_W(PW), .STAGES(AR_STAGES), .SIDE_W(R_SIDE_W),
+                     .NARROW_EXP_W(NARROW_EXP_W), .NARROW_MAN_W(NARROW_MAN_W), .DENORMALS(DENORMALS)) align_round (
+        .clk(clk), .hold(hold),
+        .sign_x(m_sign_prod), .exp_x((EXP_W+2)'(exp_prod)), .mant_x(mant_prod_norm),
+        .sign_y(m_eff_sign_c), .exp_y((EXP_W+2)'(m_exp_c)), .mant_y({m_mant_c_top, P'(0)}),
+        .rounding_mode(m_rounding_mode), .narrow_exp(m_narrow_exp), .narrow_man(m_narrow_man), .ftz(m_ftz),
+        .side_in({m_normal, m_pre_sign, m_pre_exp, m_pre_mant, m_pre_invalid, m_cov_path}),
+        .side_out({r_normal, r_pre_sign, r_pre_exp, r_pre_mant, r_pre_invalid, r_cov_path}),
+        .sign_out(ar_sign), .exponent_out(ar_exp), .mantissa_out(ar_mant),
+        .flag_overflow(ar_overflow), .flag_underflow(ar_underflow), .flag_inexact(ar_inexact), .cov(ar_cov)
+    );
+
+    always @(*) begin
+        // init
+        flag_invalid=r_pre_invalid; flag_overflow=0; flag_underflow=0; flag_inexact=0;
+        final_sign=r_pre_sign; final_exp=r_pre_exp; final_mant=r_pre_mant;
+        cov_round='0;
+
+        if (r_normal) begin
+            flag_overflow = ar_overflow; flag_underflow = ar_underflow; flag_inexact = ar_inexact;
+            final_sign = ar_sign; final_exp = ar_exp; final_mant = ar_mant;
+            cov_round[CV_ALIGN_STICKY +: 13] = ar_cov[12:0]; // same bin order up to CV_OVERFLOW_MAX
+            cov_round[CV_CANCEL] = ar_cov[13];
+        end
+    end
+endmodule
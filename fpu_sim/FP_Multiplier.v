@@ -0,0 +1,301 @@
+module FP_Multiplier #(
+    parameter EXP_W = 8,
+    parameter MAN_W = 23,
+    parameter STAGES = 0,               // Pipeline registers in the mantissa product (0-3)
+    parameter NARROW_EXP_W = EXP_W,     // Exponent width (own bias) selected by narrow_exp
+    parameter NARROW_MAN_W = MAN_W,     // Result fraction bits selected by narrow_man
+    parameter DENORMALS = 1             // 0: FTZ / DAZ on every op, no denormal normalize or shift
+) (
+    input clk,
+    input hold,                         // Freeze the pipeline (result not taken)
+    input [EXP_W+MAN_W:0] operand_a,
+    input [EXP_W+MAN_W:0] operand_b,
+    input [2:0]  rounding_mode,
+    input        narrow_exp,            // Operands and result are a narrower format held in this one:
+    input        narrow_man,            // a NARROW_EXP_W exponent in the same field, the top NARROW_MAN_W fraction bits
+    input        ftz,                   // Denormal operands read as zero, tiny results flush to zero
+    output reg [EXP_W+MAN_W:0] result,
+    output reg       flag_invalid,
+    output reg       flag_overflow,
+    output reg       flag_underflow,
+    output reg       flag_inexact,
+    output reg [15:0] cov               // Corner paths this op took, bin n on bit n (fpu_cov.h)
+);
+    // --- Coverage bins ---
+    localparam CV_INVALID = 0, CV_INF = 1, CV_ZERO = 2, CV_DENORM_IN = 3, CV_EARLY_OVERFLOW = 4, CV_EARLY_UNDERFLOW = 5;
+    localparam CV_PROD_GE2 = 6, CV_DENORM_OUT = 7, CV_DENORM_STICKY = 8;
+    localparam CV_RNE_UP = 9;           // RNE, RDN, RUP, RMM rounded up: 9..12
+    localparam CV_ROUND_CARRY = 13, CV_UNDERFLOW = 14, CV_EXACT = 15;
+
+    localparam P = MAN_W + 1;           // mantissa with hidden bit
+    localparam BIAS = (1 << (EXP_W - 1)) - 1;
+    localparam NARROW_BIAS = (1 << (NARROW_EXP_W - 1)) - 1;
+    localparam DROP = MAN_W - NARROW_MAN_W; // fraction bits below the narrow_man rounding point
+    localparam LZ_W = $clog2(P + 1);
+    localparam DEN_W = $clog2(P + 1);   // denormal shift, at most P
+
+    // round-up decision shared by the normal-precision tininess check and the final rounding
+    function automatic round_inc(input [2:0] mode, input sign, input lsb, input g, input r, input s);
+        case (mode)
+            3'b000: round_inc = g & (lsb | r | s); // RNE
+            3'b001: round_inc = 1'b0; // RTZ
+            3'b010: round_inc = (g | r | s) & sign; // RDN
+            3'b011: round_inc = (g | r | s) & ~sign; // RUP
+            3'b100: round_inc = g; // RMM
+            default: round_inc = 1'b0;
+        endcase
+    endfunction
+
+    // {lsb, guard, round, sticky} of the rounding window, DROP positions higher with narrow_man
+    function automatic [3:0] grs(input [2*P-1:0] m, input narrow);
+        if (narrow) grs = {m[P+DROP], m[P+DROP-1], m[P+DROP-2], |m[P+DROP-3:0]};
+        else        grs = {m[P], m[P-1], m[P-2], |m[P-3:0]};
+    endfunction
+
+    // largest finite exponent and the fraction bits in use of either format
+    function automatic [EXP_W-1:0] max_normal_exp(input narrow);
+        max_normal_exp = narrow ? EXP_W'((1 << NARROW_EXP_W) - 2) : EXP_W'((1 << EXP_W) - 2);
+    endfunction
+
+    function automatic [P-1:0] fraction_keep(input narrow);
+        fraction_keep = narrow ? ({P{1'b1}} << DROP) : '1;
+    endfunction
+
+    wire [EXP_W-1:0] bias = narrow_exp ? EXP_W'(NARROW_BIAS) : EXP_W'(BIAS);
+
+    // operand a
+    reg sign_a_dec;
+    reg [EXP_W-1:0] exp_a_dec;
+    reg [P-1:0] mant_a_dec;
+    reg is_a_zero, is_a_infinity, is_a_nan, is_a_denormal;
+
+    // operand b
+    reg sign_b_dec;
+    reg [EXP_W-1:0] exp_b_dec;
+    reg [P-1:0] mant_b_dec;
+    reg is_b_zero, is_b_infinity, is_b_nan, is_b_denormal;
+
+    // result
+    reg final_sign;
+    reg [EXP_W-1:0] final_exp;
+    reg [P-1:0] final_mant;
+
+    // Decode / Encode
+    wire daz = ftz || !DENORMALS;
+    FP_Decoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) decoder_a ( .fp_in(operand_a), .daz(daz), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    FP_Decoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) decoder_b ( .fp_in(operand_b), .daz(daz), .sign_out(sign_b_dec), .exponent_out(exp_b_dec), .mantissa_out(mant_b_dec), .is_zero(is_b_zero), .is_infinity(is_b_infinity), .is_nan(is_b_nan), .is_denormal(is_b_denormal) );
+    FP_Encoder #(.EXP_W(EXP_W), .MAN_W(MAN_W)) encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result) );
+
+    // local variables
+    reg normal_path_enable;
+    reg pre_sign;
+    reg [EXP_W-1:0] pre_exp;
+    reg [P-1:0] pre_mant;
+    reg pre_invalid, pre_overflow, pre_underflow, pre_inexact;
+    reg pre_denorm;                     // a denormal operand reached the normal path (coverage)
+    int exp_diff;
+    reg [P-1:0] mant_a_mul, mant_b_mul;
+
+    // --- Denormal pre-normalization ---
+    // without DENORMALS no operand decodes as a denormal
+    wire [LZ_W-1:0] lz_a, lz_b;
+    wire [P-1:0] mant_a_norm, mant_b_norm;
+
+    generate
+        if (DENORMALS) begin : denorm_in
+            LZC #(.WIDTH(P)) lzc_a ( .data_in(mant_a_dec), .count(lz_a) );
+            LZC #(.WIDTH(P)) lzc_b ( .data_in(mant_b_dec), .count(lz_b) );
+            Barrel_Shifter #(.WIDTH(P), .SHIFT_W(LZ_W)) norm_a ( .data_in(mant_a_dec), .shift_amt(lz_a), .shift_right(1'b0), .data_out(mant_a_norm) );
+            Barrel_Shifter #(.WIDTH(P), .SHIFT_W(LZ_W)) norm_b ( .data_in(mant_b_dec), .shift_amt(lz_b), .shift_right(1'b0), .data_out(mant_b_norm) );
+        end else begin : no_denorm_in
+            assign lz_a = '0; assign lz_b = '0;
+            assign mant_a_norm = mant_a_dec; assign mant_b_norm = mant_b_dec;
+        end
+    endgenerate
+
+    always @(*) begin
+        // init
+        pre_invalid=0; pre_overflow=0; pre_underflow=0; pre_inexact=0;
+        pre_denorm = 0;
+        normal_path_enable = 1;
+
+        pre_exp = '0; pre_mant = '0;
+
+        // --- 1. Special Value Handling ---
+        pre_sign = sign_a_dec ^ sign_b_dec;
+        if (is_a_nan || is_b_nan) begin
+            normal_path_enable = 0;
+            pre_invalid = 1;
+            pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, (P-2)'(0)}; // NaN
+        end else if ((is_a_zero && is_b_infinity)||(is_a_infinity && is_b_zero)) begin
+            normal_path_enable = 0;
+            pre_invalid = 1;
+            pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, (P-2)'(0)}; // NaN
+        end else if (is_a_zero || is_b_zero) begin
+            normal_path_enable = 0;
+            pre_exp = '0; pre_mant = '0; // 0
+        end else if (is_a_infinity || is_b_infinity) begin
+            normal_path_enable = 0;
+            pre_exp = '1; pre_mant = '0; // Inf
+        end
+
+        // init
+        exp_diff = int'(bias);
+        mant_a_mul = mant_a_dec; mant_b_mul = mant_b_dec;
+
+        // --- 2. Normal Path ---
+        if (normal_path_enable) begin
+            // exponent
+            exp_diff += (int'(exp_a_dec) - int'(bias)) + (int'(exp_b_dec) - int'(bias));
+
+                // denormal handling: the leading 1 moves up to the hidden bit, the first
+                // position accounts for the denormal exponent being 1 rather than 0
+                pre_denorm = is_a_denormal | is_b_denormal;
+                if (is_a_denormal) begin
+                    mant_a_mul = mant_a_norm; exp_diff -= int'(lz_a) - 1;
+                end
+                if (is_b_denormal) begin
+                    mant_b_mul = mant_b_norm; exp_diff -= int'(lz_b) - 1;
+                end
+
+            // below half the smallest denormal, or at least 2^(BIAS+1)
+            if (exp_diff < -P) begin
+                normal_path_enable = 0;
+                pre_underflow = 1;
+                pre_inexact = 1;
+                pre_exp = '0; pre_mant = daz ? '0 : P'(round_inc(rounding_mode, pre_sign, 1'b0, 1'b0, 1'b0, 1'b1)) << (narrow_man ? DROP : 0); // 0 or min denormal
+            end
+            else if (exp_diff > int'(max_normal_exp(narrow_exp))) begin
+                normal_path_enable = 0;
+                pre_overflow = 1;
+                pre_inexact = 1;
+                if (rounding_mode == 3'b001 || (rounding_mode == 3'b010 && !pre_sign) || (rounding_mode == 3'b011 && pre_sign)) begin
+                    pre_exp = max_normal_exp(narrow_exp); pre_mant = fraction_keep(narrow_man); // max normal
+                end else begin
+                    pre_exp = '1; pre_mant = '0; // Inf
+                end
+            end
+        end
+    end
+
+    // --- 3. Mantissa Product ---
+    // Booth / carry-save tree with STAGES pipeline registers; everything the rounding needs
+    // travels alongside as sideband and comes out as r_*.
+    localparam SIDE_W = EXP_W + P + 45;
+    reg r_normal, r_sign;
+    reg [EXP_W-1:0] r_pre_exp;
+    reg [P-1:0] r_pre_mant;
+    reg r_pre_invalid, r_pre_overflow, r_pre_underflow, r_pre_inexact, r_pre_denorm;
+    reg signed [31:0] r_exp;
+    reg [2:0] r_rounding_mode;
+    reg r_narrow_exp, r_narrow_man, r_ftz;
+    wire [2*P-1:P-3] prod_hi;
+    wire prod_sticky;
+
+    Booth_Multiplier #(.WIDTH(P), .STAGES(STAGES), .LOW_BITS(P-3), .SIDE_W(SIDE_W)) booth_mul (
+        .clk(clk), .hold(hold),
+        .mant_a(mant_a_mul), .mant_b(mant_b_mul),
+        .side_in({normal_path_enable, pre_sign, pre_exp, pre_mant, pre_invalid, pre_overflow, pre_underflow, pre_inexact, exp_diff, rounding_mode, pre_denorm, narrow_exp, narrow_man, ftz}),
+        .product_hi(prod_hi), .sticky(prod_sticky),
+        .side_out({r_normal, r_sign, r_pre_exp, r_pre_mant, r_pre_invalid, r_pre_overflow, r_pre_underflow, r_pre_inexact, r_exp, r_rounding_mode, r_pre_denorm, r_narrow_exp, r_narrow_man, r_ftz})
+    );
+
+    wire [EXP_W-1:0] r_exp_max_normal = max_normal_exp(r_narrow_exp);
+    wire [P-1:0] r_man_keep = fraction_keep(r_narrow_man);
+    wire flush = r_ftz || !DENORMALS;
+
+    // bits below P-3 only ever reach the sticky bit
+    wire [2*P-1:0] mul_mant = {prod_hi, (P-4)'(0), prod_sticky};
+
+    // --- 4. Denormal put it back ---
+    // mul_mant has the 1's place at 2P-2; a result below the normal range is shifted so that the
+    // 1's place of exponent 1 lands at 2P-1, the hidden bit of the rounding window below;
+    // flushed results skip it
+    wire prod_ge2 = mul_mant[2*P-1];
+    wire den = (r_exp < 0) || (r_exp == 0 && !prod_ge2);
+    wire [2*P-1:0] mul_mant_den;
+    wire den_lost;                      // shifted out, kept as sticky
+
+    generate
+        if (DENORMALS) begin : denorm_out
+            wire [DEN_W-1:0] den_shift = den ? DEN_W'(-r_exp) : '0;
+            assign den_lost = |(mul_mant & ~({(2*P){1'b1}} << den_shift));
+            Barrel_Shifter #(.WIDTH(2*P), .SHIFT_W(DEN_W)) den_shifter ( .data_in(mul_mant), .shift_amt(den_shift), .shift_right(1'b1), .data_out(mul_mant_den) );
+        end else begin : no_denorm_out
+            assign den_lost = 1'b0;
+            assign mul_mant_den = mul_mant;
+        end
+    endgenerate
+
+    // --- 5. Rounding ---
+    // round_mant: hidden bit at 2P-1, result mantissa [2P-1:P], guard P-1, round P-2, sticky below
+    int exp_norm;
+    reg [2*P-1:0] round_mant;
+    reg [P:0] mant_round;
+    reg lsb, g_bit, r_bit, s_bit, round_up, tiny;
+
+    always @(*) begin
+        // init
+        flag_invalid=r_pre_invalid; flag_overflow=r_pre_overflow; flag_underflow=r_pre_underflow; flag_inexact=r_pre_inexact;
+        final_sign=r_sign; final_exp=r_pre_exp; final_mant=r_pre_mant;
+        exp_norm = 0; round_mant = '0; mant_round = '0;
+        lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0; tiny = 0;
+        cov = '0;
+        // special and early-exit paths, from the pre stage values that came out with the product
+        cov[CV_INVALID] = r_pre_invalid;
+        cov[CV_INF] = !r_normal && !r_pre_invalid && !r_pre_overflow && &r_pre_exp;
+        cov[CV_ZERO] = !r_normal && !r_pre_invalid && !r_pre_underflow && r_pre_exp == 0;
+        cov[CV_DENORM_IN] = r_pre_denorm;
+        cov[CV_EARLY_OVERFLOW] = r_pre_overflow;
+        cov[CV_EARLY_UNDERFLOW] = r_pre_underflow;
+
+        if (r_normal) begin
+            // normalize to [1, 2)
+            cov[CV_PROD_GE2] = prod_ge2;
+            if (prod_ge2) begin round_mant = mul_mant; exp_norm = r_exp + 1; end
+            else begin round_mant = mul_mant << 1; exp_norm = r_exp; end
+
+            // tininess (after rounding, unbounded exponent)
+            tiny = den;
+            if (exp_norm == 0 && (&(round_mant[2*P-1:P] | ~r_man_keep))) begin
+                {lsb, g_bit, r_bit, s_bit} = grs(round_mant, r_narrow_man);
+                tiny = !round_inc(r_rounding_mode, r_sign, lsb, g_bit, r_bit, s_bit);
+            end
+
+            // denormal put it back
+            if (den && !flush) begin
+                round_mant = mul_mant_den | {{(2*P-1){1'b0}}, den_lost}; exp_norm = 0;
+                cov[CV_DENORM_OUT] = 1; cov[CV_DENORM_STICKY] = den_lost;
+            end
+
+            // rounding
+            {lsb, g_bit, r_bit, s_bit} = grs(round_mant, r_narrow_man);
+            flag_inexact = g_bit | r_bit | s_bit;
+            round_up = round_inc(r_rounding_mode, r_sign, lsb, g_bit, r_bit, s_bit);
+            cov[CV_RNE_UP +: 4] = round_up ? {r_rounding_mode == 3'b100, r_rounding_mode == 3'b011, r_rounding_mode == 3'b010, r_rounding_mode == 3'b000} : 4'b0;
+            mant_round = {1'b0, round_mant[2*P-1:P] & r_man_keep} + ((P+1)'(round_up) << (r_narrow_man ? DROP : 0));
+            if (mant_round[P]) begin mant_round >>= 1; exp_norm += 1; cov[CV_ROUND_CARRY] = 1; end
+            if (exp_norm == 0 && mant_round[P-1] && !flush) exp_norm = 1; // denormal rounded up to min normal
+
+            // OF / UF
+            if (exp_norm > int'(r_exp_max_normal)) begin
+                flag_overflow = 1; flag_inexact = 1;
+                if (r_rounding_mode == 3'b001 || (r_rounding_mode == 3'b010 && !r_sign) || (r_rounding_mode == 3'b011 && r_sign)) begin
+                    final_exp = r_exp_max_normal; final_mant = r_man_keep; // max normal
+                end else begin
+                    final_exp = '1; final_mant = '0; // Inf
+                end
+            end else if (flush && tiny) begin
+                flag_underflow = 1; flag_inexact = 1;
+                final_exp = '0; final_mant = '0; // zero of the result's sign
+            end else begin
+                flag_underflow = tiny & flag_inexact;
+                final_exp = exp_norm[EXP_W-1:0];
+                final_mant = mant_round[P-1:0];
+            end
+            cov[CV_UNDERFLOW] = flag_underflow;
+            cov[CV_EXACT] = !flag_inexact;
+        end
+    end
+
+endmodule
@@ -0,0 +1,46 @@
+module Issue_Queue #(
+    parameter WIDTH = 8,                // Bits per entry
+    parameter DEPTH = 2                 // Entries
+) (
+    input clk,
+    input rst_n,
+
+    input              push,            // Append push_data (ignored while full)
+    input  [WIDTH-1:0] push_data,
+    output             full,
+
+    input              pop,             // Drop the head entry (ignored while empty)
+    output [WIDTH-1:0] head,            // Oldest entry, valid while !empty
+    output             empty
+);
+
+    localparam PTR_W = (DEPTH > 1) ? $clog2(DEPTH) : 1;
+
+    reg [WIDTH-1:0] entry [0:DEPTH-1];
+    reg [PTR_W-1:0] rd_ptr, wr_ptr;
+    reg [PTR_W:0]   count;
+
+    wire do_push = push && !full;
+    wire do_pop = pop && !empty;
+
+    assign full = (count == DEPTH);
+    assign empty = (count == 0);
+    assign head = entry[rd_ptr];
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            rd_ptr <= '0;
+            wr_ptr <= '0;
+            count <= '0;
+        end else begin
+            if (do_push) wr_ptr <= (wr_ptr == PTR_W'(DEPTH - 1)) ? '0 : wr_ptr + 1'b1;
+            if (do_pop) rd_ptr <= (rd_ptr == PTR_W'(DEPTH - 1)) ? '0 : rd_ptr + 1'b1;
+            count <= count + (PTR_W+1)'(do_push) - (PTR_W+1)'(do_pop);
+        end
+    end
+
+    always @(posedge clk) begin
+        if (do_push) entry[wr_ptr] <= push_data;
+    end
+
+endmodule
@@ -0,0 +1,33 @@
+module LZC #(
+    parameter WIDTH = 32
+) (
+    input  [WIDTH-1:0]              data_in,
+    output [$clog2(WIDTH+1)-1:0]    count       // Leading zeros, WIDTH when data_in is 0
+);
+    // Binary tree over data_in padded to a power of two with a 1 right below the LSB, so an
+    // all-zero input counts to WIDTH. Each level merges node pairs: if the upper half holds a
+    // 1 its count passes through, otherwise the lower count plus the half width.
+    localparam LEVELS = $clog2(WIDTH + 1);
+    localparam PAD_W = 1 << LEVELS;
+
+    genvar l, n;
+    generate
+        for (l = 0; l <= LEVELS; l++) begin : level
+            wire [(PAD_W >> l)-1:0]         valid;  // node contains a 1
+            wire [(PAD_W >> l)*LEVELS-1:0]  cnt;    // zeros above the first 1 inside the node
+            if (l == 0) begin : leaf
+                assign valid = PAD_W'({data_in, 1'b1}) << (PAD_W - WIDTH - 1);
+                assign cnt = '0;
+            end else begin : node
+                for (n = 0; n < (PAD_W >> l); n++) begin : merge
+                    wire hi = level[l-1].valid[2*n+1];
+                    assign valid[n] = hi | level[l-1].valid[2*n];
+                    assign cnt[n*LEVELS +: LEVELS] = hi ? level[l-1].cnt[(2*n+1)*LEVELS +: LEVELS]
+                                                        : (level[l-1].cnt[2*n*LEVELS +: LEVELS] | (LEVELS'(1) << (l-1)));
+                end
+            end
+        end
+    endgenerate
+
+    assign count = level[LEVELS].cnt[LEVELS-1:0];
+endmodule
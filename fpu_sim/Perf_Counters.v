@@ -0,0 +1,31 @@
+module Perf_Counters #(
+    parameter NUM = 33,                 // Number of counters
+    parameter WIDTH = 64,               // Bits per counter
+    parameter ADDR_W = 6
+) (
+    input clk,
+    input rst_n,
+
+    input  [NUM-1:0]    inc,            // Counter n counts one event this cycle
+    input               clear,          // Zero every counter (wins over inc)
+
+    input  [ADDR_W-1:0] addr,           // Read port, combinational
+    output [WIDTH-1:0]  rdata           // Counter addr, 0 beyond NUM
+);
+
+    reg [WIDTH-1:0] count [0:NUM-1];
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            for (int n = 0; n < NUM; n++) count[n] <= '0;
+        end else begin
+            for (int n = 0; n < NUM; n++) begin
+                if (clear) count[n] <= '0;
+                else if (inc[n]) count[n] <= count[n] + 1'b1;
+            end
+        end
+    end
+
+    assign rdata = (addr < NUM) ? count[addr] : '0;
+
+endmodule
@@ -1,13 +1,17 @@
-module SP_Convert (
+module SP_Convert #(
+    parameter DENORMALS = 1     // 0: denormal inputs always read as zero, no normalize hardware
+) (
     input [31:0]    operand_in,
     input [1:0]     input_type,
     input [1:0]     output_type,
     input [2:0]     rounding_mode,
+    input           ftz,            // A denormal FP32 input reads as zero
     output reg [63:0]   result,
     output reg      flag_invalid,
     output reg      flag_overflow,
     output reg      flag_underflow,
-    output reg      flag_inexact
+    output reg      flag_inexact,
+    output reg [14:0]   cov             // Corner paths this op took, bin n on bit n (fpu_cov.h)
 );
     // --- Type & Constant Definitions ---
     localparam FP_TYPE_FP32 = 2'b00, FP_TYPE_FP64 = 2'b01;
@@ -24,6 +28,24 @@ module SP_Convert (
     localparam RUP = 3'b011;
     localparam RMM = 3'b100;
 
+    // --- Coverage bins ---
+    localparam CV_NAN = 0, CV_INF = 1, CV_ZERO = 2, CV_DENORM_IN = 3, CV_INT_NEGATIVE = 4, CV_UINT_NEGATIVE = 5;
+    localparam CV_FRAC = 6, CV_FRAC_ROUNDED = 7, CV_INT_OVERFLOW = 8, CV_INT_MIN = 9;
+    localparam CV_RNE_UP = 10;          // RNE, RDN, RUP, RMM rounded up: 10..13
+    localparam CV_ROUND_OVERFLOW = 14;
+
+    // round-up decision shared by the normal-precision tininess check and the final rounding
+    function automatic round_inc(input [2:0] mode, input sign, input lsb, input g, input r, input s);
+        case (mode)
+            3'b000: round_inc = g & (lsb | r | s); // RNE
+            3'b001: round_inc = 1'b0; // RTZ
+            3'b010: round_inc = (g | r | s) & sign; // RDN
+            3'b011: round_inc = (g | r | s) & ~sign; // RUP
+            3'b100: round_inc = g; // RMM
+            default: round_inc = 1'b0;
+        endcase
+    endfunction
+
     // operand a
     reg sign_a_dec;
     reg [7:0] exp_a_dec;
@@ -36,16 +58,37 @@ module SP_Convert (
     reg [52:0] final_mant;
 
     reg [63:0] result_dp;
-    reg [63:0] shifted_val;
     reg [63:0] result_int;
     
     // Decode / Encode
-    SP_Decoder decoder_a ( .fp_in(operand_in), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    SP_Decoder decoder_a ( .fp_in(operand_in), .daz(ftz || !DENORMALS), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
     DP_Encoder encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result_dp) );
 
+    // --- Normalization (denormal SP input, INT input) ---
+    wire [4:0] lz_a;
+    wire [23:0] mant_a_norm;
+    wire [31:0] int_abs = ((input_type == FP_TYPE_INT32) && operand_in[31]) ? -operand_in[31:0] : operand_in[31:0];
+    wire [5:0] lz_int;
+    wire [31:0] int_norm;
+
+    generate
+        if (DENORMALS) begin : denorm_in
+            LZC #(.WIDTH(24)) lzc_a ( .data_in(mant_a_dec), .count(lz_a) );
+            Barrel_Shifter #(.WIDTH(24), .SHIFT_W(5)) norm_a ( .data_in(mant_a_dec), .shift_amt(lz_a), .shift_right(1'b0), .data_out(mant_a_norm) );
+        end else begin : no_denorm_in
+            assign lz_a = '0;
+            assign mant_a_norm = mant_a_dec;
+        end
+    endgenerate
+    LZC #(.WIDTH(32)) lzc_int ( .data_in(int_abs), .count(lz_int) );
+    Barrel_Shifter #(.WIDTH(32), .SHIFT_W(6)) norm_int ( .data_in(int_abs), .shift_amt(lz_int), .shift_right(1'b0), .data_out(int_norm) );
+
     reg normal_path_enable;
     reg lsb, g_bit, r_bit, s_bit, round_up;
-    int shift_amt;
+    int int_exp;
+    reg [95:0] int_fixed;
+    reg [32:0] int_mag;
+    reg int_inexact;
 
     always @(*) begin
 
@@ -54,10 +97,10 @@ module SP_Convert (
         normal_path_enable = 1;
 
         final_sign=0; final_exp='0; final_mant='0;
-        shifted_val = '0;
         result_int = '0;
         lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0;
-        shift_amt = 0;
+        int_exp = 0; int_fixed = '0; int_mag = '0; int_inexact = 0;
+        cov = '0;
 
         // --- 1. Special Value Handling ---
         if (input_type == FP_TYPE_FP32) begin
@@ -65,6 +108,7 @@ module SP_Convert (
 
                 normal_path_enable = 0;
                 flag_invalid = 1; // NV
+                cov[CV_NAN] = 1;
                 if (output_type == FP_TYPE_INT32) begin result_int = INT32_MIN_VAL; end // int32
                 else if (output_type == FP_TYPE_UINT32) begin result_int = UINT32_MAX_VAL; end // uint32
                 else begin final_sign = 0; final_exp = '1; final_mant = FP64_QNAN_MANT; end // double (NaN)
@@ -72,6 +116,7 @@ module SP_Convert (
             end else if (is_a_infinity) begin
 
                 normal_path_enable = 0;
+                cov[CV_INF] = 1;
                 if (output_type == FP_TYPE_INT32) begin flag_invalid = 1; flag_overflow = 1; result_int = (sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL; end // int32 (NV, OF)
                 else if (output_type == FP_TYPE_UINT32) begin flag_invalid = 1; flag_overflow = !sign_a_dec; result_int = (sign_a_dec) ? UINT32_MIN_VAL : UINT32_MAX_VAL; end // uint32 (NV, OF(+))
                 else begin final_sign = sign_a_dec; final_exp = '1; final_mant = '0; end // double (inf)
@@ -79,6 +124,7 @@ module SP_Convert (
             end else if (is_a_zero) begin
 
                 normal_path_enable = 0;
+                cov[CV_ZERO] = 1;
                 if (output_type == FP_TYPE_INT32 || output_type == FP_TYPE_UINT32) begin result_int = '0; end // 0
                 else begin final_sign = sign_a_dec; final_exp = '0; final_mant = '0; end // 0
 
@@ -88,6 +134,7 @@ module SP_Convert (
 
             normal_path_enable = 0;
             final_sign = 0; final_exp = '0; final_mant = '0; // 0
+            cov[CV_ZERO] = 1;
 
         end
 
@@ -98,150 +145,74 @@ module SP_Convert (
                 final_sign = sign_a_dec; final_exp = {3'b0, exp_a_dec} + 11'd896; final_mant = {mant_a_dec, 29'b0}; // DP convert
 
                 // handle denormal
-                if (exp_a_dec == 8'b0) begin
-                    final_exp += 11'd1;
-                    for (int i = 52; i >= 29; i--) begin
-                        if (!final_mant[52]) begin
-                            final_mant <<= 1; final_exp -= 1;
-                        end else begin
-                            i = 0;
-                        end
-                    end
+                if (is_a_denormal) begin
+                    cov[CV_DENORM_IN] = 1;
+                    final_exp += 11'd1 - {6'b0, lz_a};
+                    final_mant = {mant_a_norm, 29'b0};
                 end
             end
 
-            // --- SP -> UINT Conversion ---
-            else if ((input_type == FP_TYPE_FP32) && (output_type == FP_TYPE_UINT32)) begin
-                if (sign_a_dec) begin // negative
-                    result_int = '0;
-                    flag_invalid = 1;
-                end else if (exp_a_dec < 127) begin // 0.xx
-                    result_int = '0;
-                    flag_inexact = |mant_a_dec[23:0];
-                    if (flag_inexact && (rounding_mode == RUP)) begin
-                        result_int = 64'd1;
-                    end
-                end else if (exp_a_dec > 158) begin // over 2^32
-                    flag_invalid = 1;
-                    flag_overflow = 1;
-                    flag_inexact = 1;
-                    result_int = UINT32_MAX_VAL;
+            // --- SP -> INT / UINT Conversion ---
+            else if ((input_type == FP_TYPE_FP32) && (output_type == FP_TYPE_INT32 || output_type == FP_TYPE_UINT32)) begin
+                // fixed point with the binary point at bit 64; 2^32 and up is out of range either way
+                int_exp = (is_a_denormal ? 1 : int'(exp_a_dec)) - 127;
+                cov[CV_FRAC] = (int_exp < 0);
+                if (int_exp > 31) begin
+                    int_mag = 33'h1_0000_0000; int_inexact = 0;
+                    cov[CV_INT_OVERFLOW] = 1;
                 end else begin
-                    shift_amt = 150 - {24'b0, exp_a_dec}; // 150 = 127 + 23
-                    
-                    if (shift_amt >= 0) begin
-                        result_int = {40'b0, mant_a_dec} >> shift_amt;
-                        shifted_val = {40'b0, mant_a_dec} << (24 - shift_amt);
-                    end else begin
-                        result_int = {40'b0, mant_a_dec} << -shift_amt;
-                        shifted_val = {40'b0, mant_a_dec} >> (shift_amt - 24);
-                    end
-
-                    // rounding
-                    lsb = result_int[0];
-                    g_bit = shifted_val[23];
-                    r_bit = shifted_val[22];
-                    s_bit = |shifted_val[21:0];
-                    flag_inexact = g_bit | r_bit | s_bit;
-                    case (rounding_mode)
-                        3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                        3'b001: round_up = 1'b0; // RTZ
-                        3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                        3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                        3'b100: round_up = flag_inexact; //RMM
-                        default: round_up = 1'b0;
-                    endcase
-                    result_int += {63'b0, round_up};
-
-                    if (result_int[63:32] != 0) begin
-                        flag_invalid=1; flag_inexact=1; result_int=UINT32_MAX_VAL;
-                    end
+                    if (int_exp < -2) int_fixed = 96'd1; // below 1/4: sticky only
+                    else int_fixed = {72'b0, mant_a_dec} << (int_exp + 41);
+                    lsb = int_fixed[64]; g_bit = int_fixed[63]; s_bit = |int_fixed[62:0];
+                    int_inexact = g_bit | s_bit;
+                    round_up = round_inc(rounding_mode, sign_a_dec, lsb, g_bit, 1'b0, s_bit);
+                    int_mag = {1'b0, int_fixed[95:64]} + 33'(round_up);
+                    cov[CV_FRAC_ROUNDED] = (int_exp < 0) && (int_mag != 0);
                 end
-            end
 
-            // --- SP -> INT Conversion ---
-            else if ((input_type == FP_TYPE_FP32) && (output_type == FP_TYPE_INT32)) begin
-                if (exp_a_dec < 127) begin // 0.xx
-                    result_int = '0;
-                    flag_inexact = |mant_a_dec[23:0];
-                    if (flag_inexact) begin
-                        if (!sign_a_dec && (rounding_mode == RUP)) begin result_int = 64'd1; end // 1
-                        else if (sign_a_dec && (rounding_mode == RDN)) begin result_int = {32'b0, -$signed(32'd1)}; end // -1
-                    end
-                end else if (exp_a_dec >= 158) begin
-                    if (sign_a_dec && (exp_a_dec == 158) && (mant_a_dec == {1'b1, 23'b0})) begin result_int = INT32_MIN_VAL; end
-                    else begin
-                        flag_invalid = 1;
-                        flag_overflow = 1;
-                        flag_inexact = 1;
-                        result_int = (sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL;
+                // range and sign
+                if (output_type == FP_TYPE_UINT32) begin
+                    if (sign_a_dec && int_mag != 0) begin
+                        flag_invalid = 1; result_int = '0;
+                        cov[CV_UINT_NEGATIVE] = 1;
+                    end else if (int_mag[32]) begin
+                        flag_invalid = 1; flag_overflow = 1; flag_inexact = 1; result_int = UINT32_MAX_VAL;
+                        cov[CV_ROUND_OVERFLOW] = (int_exp <= 31);
+                    end else begin
+                        flag_inexact = int_inexact; result_int = int_mag[31:0];
                     end
                 end else begin
-                    shift_amt = 150 - {24'b0, exp_a_dec}; // 150 = 127 + 23
-                    
-                    if (shift_amt >= 0) begin
-                        result_int = {40'b0, mant_a_dec} >> shift_amt;
-                        shifted_val = {40'b0, mant_a_dec} << (23 - shift_amt);
+                    if (int_mag > (sign_a_dec ? 33'h0_8000_0000 : 33'h0_7FFF_FFFF)) begin
+                        flag_invalid = 1; flag_overflow = 1; flag_inexact = 1; result_int = (sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL;
+                        cov[CV_ROUND_OVERFLOW] = (int_exp <= 31);
                     end else begin
-                        result_int = {40'b0, mant_a_dec} << -shift_amt;
-                        shifted_val = {40'b0, mant_a_dec} >> (shift_amt - 23);
-                    end
-
-                    // rounding
-                    lsb = result_int[0];
-                    g_bit = shifted_val[23];
-                    r_bit = shifted_val[22];
-                    s_bit = |shifted_val[21:0];
-                    flag_inexact = g_bit | r_bit | s_bit;
-                    case (rounding_mode)
-                        3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                        3'b001: round_up = 1'b0; // RTZ
-                        3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                        3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                        3'b100: round_up = flag_inexact; //RMM
-                        default: round_up = 1'b0;
-                    endcase
-                    result_int += {63'b0, round_up};
-
-                    if (result_int[31:0] == {1'b1, 31'b0}) begin
-                        if (sign_a_dec) begin result_int = INT32_MIN_VAL; end
-                        else begin flag_invalid=1; flag_inexact=1; result_int=(sign_a_dec) ? INT32_MIN_VAL : INT32_MAX_VAL; end
+                        flag_inexact = int_inexact; result_int = {32'b0, 32'(sign_a_dec ? -int_mag[31:0] : int_mag[31:0])};
+                        cov[CV_INT_MIN] = sign_a_dec && int_mag[31];
                     end
-
-                    if(sign_a_dec) begin result_int = {32'b0, -$signed(result_int[31:0])}; end
                 end
             end
 
             // --- INT -> DP Conversion ---
             else begin
                 final_sign = (input_type == FP_TYPE_INT32) && operand_in[31];
+                cov[CV_INT_NEGATIVE] = final_sign;
                 final_exp = 11'd1054; // 2^31
-                result_int = (final_sign) ? {1'b0, -operand_in[31:0], 31'b0} : {1'b0, operand_in[31:0], 31'b0};
-
-                for(int i = 31 ; i >= 0 ; i--) begin
-                    if (!result_int[62]) begin final_exp -= 1; result_int <<= 1; end
-                    else begin i = 0; end
-                end
+                final_exp -= {5'b0, lz_int};
+                result_int = {1'b0, int_norm, 31'b0};
 
                 lsb = result_int[10];
                 g_bit = result_int[9];
                 r_bit = result_int[8];
                 s_bit = result_int[7];
                 flag_inexact = g_bit | r_bit | s_bit;
-                case (rounding_mode)
-                    3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                    3'b001: round_up = 1'b0; // RTZ
-                    3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                    3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                    3'b100: round_up = flag_inexact; //RMM
-                    default: round_up = 1'b0;
-                endcase
+                round_up = round_inc(rounding_mode, final_sign, lsb, g_bit, r_bit, s_bit);
                 if (round_up) begin result_int += {53'b0, 1'b1, 10'b0}; end
                 if (result_int[63]) begin final_exp += 1; result_int >>= 1; end
 
                 final_mant = result_int[62:10];
             end
         end
+        cov[CV_RNE_UP +: 4] = round_up ? {rounding_mode == RMM, rounding_mode == RUP, rounding_mode == RDN, rounding_mode == RNE} : 4'b0;
     end
 
     always @(*) begin
@@ -1,5 +1,6 @@
 module SP_Decoder (
     input  [31:0] fp_in,
+    input  daz,                 // 1: a denormal decodes as a zero of the same sign
 
     // SP decode
     output sign_out,
@@ -13,20 +14,6 @@ module SP_Decoder (
     output is_denormal
 );
 
-    // intermediate logic
-    wire is_exp_max = (fp_in[30:23] == 8'hFF);
-    wire is_exp_zero = (fp_in[30:23] == 0);
-    wire is_mant_zero = (fp_in[22:0] == 0);
-
-    // set flag
-    assign is_zero      = is_exp_zero && is_mant_zero;
-    assign is_infinity  = is_exp_max  && is_mant_zero;
-    assign is_nan       = is_exp_max  && !is_mant_zero;
-    assign is_denormal  = is_exp_zero && !is_mant_zero;
-
-    // decoded parts
-    assign sign_out = fp_in[31];
-    assign exponent_out = fp_in[30:23];
-    assign mantissa_out = (is_denormal) ?{1'b0, fp_in[22:0]} :{1'b1, fp_in[22:0]};
+    FP_Decoder #(.EXP_W(8), .MAN_W(23)) decoder ( .fp_in(fp_in), .daz(daz), .sign_out(sign_out), .exponent_out(exponent_out), .mantissa_out(mantissa_out), .is_zero(is_zero), .is_infinity(is_infinity), .is_nan(is_nan), .is_denormal(is_denormal) );
 
 endmodule
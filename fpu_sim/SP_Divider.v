@@ -1,14 +1,44 @@
-module SP_Divider (
+module SP_Divider #(
+    parameter SRT = 0,          // 1: radix-4 SRT with a carry-save remainder, 0: restoring radix-4
+    parameter DENORMALS = 1     // 0: FTZ / DAZ on every op, no denormal normalize or shift
+) (
+    input clk,
+    input rst_n,
+    input start,                // Latch operands and begin a division (ignored while busy)
     input [31:0] operand_a,
     input [31:0] operand_b,
     input [2:0]  rounding_mode,
+    input        ftz,           // Denormal operands read as zero, tiny quotients flush to zero
+    output       busy,          // Quotient digits are being produced
+    output reg   done,          // Result and flags valid, held until the next start
     output reg [31:0] result,
     output reg       flag_invalid,
     output reg       flag_divbyzero,
     output reg       flag_overflow,
     output reg       flag_underflow,
-    output reg       flag_inexact
+    output reg       flag_inexact,
+    output [15:0]    cov        // Corner paths this op took, bin n on bit n (fpu_cov.h)
 );
+    // --- Coverage bins ---
+    localparam CV_INVALID = 0, CV_DIV_BY_ZERO = 1, CV_INF_OR_ZERO = 2, CV_DENORM_IN = 3, CV_POW2_DIVISOR = 4, CV_EXACT_EARLY = 5;
+    localparam CV_QUOT_LT1 = 6;
+    localparam CV_RNE_UP = 7;           // RNE, RDN, RUP, RMM rounded up: 7..10
+    localparam CV_ROUND_CARRY = 11, CV_OVERFLOW = 12, CV_UNDERFLOW_ZERO = 13, CV_DENORM_OUT = 14, CV_EXACT = 15;
+    reg [15:0] cov_setup, r_cov, cov_round;    // setup bins, as latched on start, rounding bins
+    assign cov = r_cov | cov_round;
+
+    // round-up decision shared by the normal-precision tininess check and the final rounding
+    function automatic round_inc(input [2:0] mode, input sign, input lsb, input g, input r, input s);
+        case (mode)
+            3'b000: round_inc = g & (lsb | r | s); // RNE
+            3'b001: round_inc = 1'b0; // RTZ
+            3'b010: round_inc = (g | r | s) & sign; // RDN
+            3'b011: round_inc = (g | r | s) & ~sign; // RUP
+            3'b100: round_inc = g; // RMM
+            default: round_inc = 1'b0;
+        endcase
+    endfunction
+
     // operand a
     reg sign_a_dec;
     reg [7:0] exp_a_dec;
@@ -25,124 +55,357 @@ module SP_Divider (
     reg final_sign;
     reg [7:0] final_exp;
     reg [23:0] final_mant;
-    
+
     // Decode / Encode
-    SP_Decoder decoder_a ( .fp_in(operand_a), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
-    SP_Decoder decoder_b ( .fp_in(operand_b), .sign_out(sign_b_dec), .exponent_out(exp_b_dec), .mantissa_out(mant_b_dec), .is_zero(is_b_zero), .is_infinity(is_b_infinity), .is_nan(is_b_nan), .is_denormal(is_b_denormal) );
+    wire daz = ftz || !DENORMALS;
+    SP_Decoder decoder_a ( .fp_in(operand_a), .daz(daz), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    SP_Decoder decoder_b ( .fp_in(operand_b), .daz(daz), .sign_out(sign_b_dec), .exponent_out(exp_b_dec), .mantissa_out(mant_b_dec), .is_zero(is_b_zero), .is_infinity(is_b_infinity), .is_nan(is_b_nan), .is_denormal(is_b_denormal) );
     SP_Encoder encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result) );
 
     // local variables
     reg normal_path_enable;
+    reg pre_sign;
+    reg [7:0] pre_exp;
+    reg [23:0] pre_mant;
+    reg pre_invalid, pre_divbyzero;
+    reg pre_flush;              // ftz quotient below the normal range, zero without dividing
 
     int exp_diff;
     reg [23:0] mant_a_div;
     reg [23:0] mant_b_div;
 
-    localparam div_precision = 60;
-    reg [div_precision + 23:0] dividend;
-    reg [div_precision + 23:0] divisor;
-    reg [1 + div_precision + 23:0] quotient;
+    // --- Denormal pre-normalization ---
+    wire [4:0] lz_a, lz_b;
+    wire [23:0] mant_a_norm, mant_b_norm;
 
-    reg lsb, g_bit, r_bit, s_bit, round_up;
+    // without DENORMALS no operand decodes as a denormal
+    generate
+        if (DENORMALS) begin : denorm_in
+            LZC #(.WIDTH(24)) lzc_a ( .data_in(mant_a_dec), .count(lz_a) );
+            LZC #(.WIDTH(24)) lzc_b ( .data_in(mant_b_dec), .count(lz_b) );
+            Barrel_Shifter #(.WIDTH(24), .SHIFT_W(5)) norm_a ( .data_in(mant_a_dec), .shift_amt(lz_a), .shift_right(1'b0), .data_out(mant_a_norm) );
+            Barrel_Shifter #(.WIDTH(24), .SHIFT_W(5)) norm_b ( .data_in(mant_b_dec), .shift_amt(lz_b), .shift_right(1'b0), .data_out(mant_b_norm) );
+        end else begin : no_denorm_in
+            assign lz_a = '0; assign lz_b = '0;
+            assign mant_a_norm = mant_a_dec; assign mant_b_norm = mant_b_dec;
+        end
+    endgenerate
 
+    // --- 1. Operand Setup (sampled on start) ---
     always @(*) begin
         // init
-        flag_invalid=0; flag_divbyzero=0; flag_overflow=0; flag_underflow=0; flag_inexact=0;
+        pre_invalid=0; pre_divbyzero=0; pre_flush=0;
         normal_path_enable = 1;
-        final_exp = '0; final_mant = '0;
+        cov_setup = '0;
+        pre_exp = '0; pre_mant = '0;
 
-        // --- 1. Special Value Handling ---
-        final_sign = sign_a_dec ^ sign_b_dec;
+        // --- 1a. Special Value Handling ---
+        pre_sign = sign_a_dec ^ sign_b_dec;
         if ((is_a_nan || is_b_nan) || (is_a_infinity && is_b_infinity) || (is_a_zero && is_b_zero)) begin
-            normal_path_enable = 0; flag_invalid = 1; final_exp = '1; final_mant = {2'b11, 22'b0}; // NAN
-        end else if (is_b_zero) begin
-            normal_path_enable = 0; flag_divbyzero = 1; final_exp = '1; final_mant = '0; // Inf
+            normal_path_enable = 0; pre_invalid = 1; pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, 22'b0}; // NAN
         end else if (is_a_infinity) begin
-            normal_path_enable = 0; final_exp = '1; final_mant = '0; // Inf
+            normal_path_enable = 0; pre_exp = '1; pre_mant = '0; // Inf
+        end else if (is_b_zero) begin
+            normal_path_enable = 0; pre_divbyzero = 1; pre_exp = '1; pre_mant = '0; // Inf
         end else if (is_a_zero) begin
-            normal_path_enable = 0; final_exp = '0; final_mant = '0; // zero
+            normal_path_enable = 0; pre_exp = '0; pre_mant = '0; // zero
         end else if (is_b_infinity) begin
-            normal_path_enable = 0; final_exp = '0; final_mant = '0; // zero
+            normal_path_enable = 0; pre_exp = '0; pre_mant = '0; // zero
         end
 
         // init
         exp_diff = 127;
         mant_a_div = mant_a_dec; mant_b_div = mant_b_dec;
-        dividend = '0; divisor = '0; quotient = '0;
-        lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0;
-
-        // --- 2. Normal Path ---
-        if (normal_path_enable) begin
-            // --- 2a. Exponent ---
-            exp_diff += ($signed({24'b0, exp_a_dec}) - 127) - ($signed({24'b0, exp_b_dec}) - 127);
-                // denormal
-                if (is_a_denormal) begin
-                    for (int i = 23 ; i > 0 ; i--) begin
-                        if (!mant_a_div[23]) begin exp_diff -= 1; mant_a_div <<= 1; end
-                        else begin i = 0; end
+
+        // --- 1b. Exponent ---
+        exp_diff += ($signed({24'b0, exp_a_dec}) - 127) - ($signed({24'b0, exp_b_dec}) - 127);
+            // denormal: the exponent of a denormal is 1, less the positions its leading 1 moves up
+            if (is_a_denormal) begin mant_a_div = mant_a_norm; exp_diff -= int'(lz_a) - 1; end
+            if (is_b_denormal) begin mant_b_div = mant_b_norm; exp_diff += int'(lz_b) - 1; end
+
+        if (mant_a_div < mant_b_div) begin exp_diff -= 1; end // carry
+
+        // --- 1c. FTZ early exit ---
+        // below exponent 0 the quotient is tiny however it rounds, so with ftz it is a zero
+        if (daz && normal_path_enable && exp_diff < 0) begin
+            normal_path_enable = 0; pre_flush = 1; pre_exp = '0; pre_mant = '0;
+        end
+
+        // coverage
+        cov_setup[CV_INVALID] = pre_invalid;
+        cov_setup[CV_DIV_BY_ZERO] = pre_divbyzero;
+        cov_setup[CV_INF_OR_ZERO] = !normal_path_enable && !pre_invalid && !pre_divbyzero && !pre_flush;
+        cov_setup[CV_DENORM_IN] = normal_path_enable && (is_a_denormal || is_b_denormal);
+        cov_setup[CV_UNDERFLOW_ZERO] = pre_flush;
+        cov_setup[CV_POW2_DIVISOR] = normal_path_enable && mant_b_div == {1'b1, 23'b0};
+    end
+
+    // --- 2. Division ---
+    // quotient = floor(mant_a * 2^QUOT_BITS / mant_b), two bits per cycle. QUOT_BITS covers 24
+    // mantissa bits + guard + round when mant_a < mant_b; everything below is folded into sticky
+    // through the final remainder, of which only the sign and whether it is zero are used.
+    //
+    // SRT = 0: restoring radix-4. The start cycle forms the integer bit, then each cycle picks the
+    // largest digit in {0,1,2,3} by comparing 4 * remainder against 1x / 2x / 3x the divisor, three
+    // full-width subtractions in parallel; a zero remainder ends the division early.
+    // SRT = 1: radix-4 SRT with a carry-save remainder. Digits are in {-2..2}, picked from an 8-bit
+    // estimate of the remainder and 3 divisor bits (srt_digit), so a cycle is a short add, a
+    // table lookup and one 3:2 carry-save row with no carry propagation. The signed digits are
+    // converted on the fly into the quotient and quotient - 1; the one carry-propagate add
+    // of the remainder happens after the last digit, when its sign picks between the two. It
+    // takes one more cycle (no integer-bit start cycle), has no early exit for exact quotients
+    // and keeps two quotient and two remainder registers.
+    localparam QUOT_BITS = 26;
+    localparam ITERATIONS = SRT ? QUOT_BITS / 2 + 1 : QUOT_BITS / 2;
+
+    reg [4:0] iter_left;
+
+    reg r_normal;
+    reg r_sign;
+    reg [2:0] r_rounding_mode;
+    reg [7:0] r_pre_exp;
+    reg [23:0] r_pre_mant;
+    reg r_pre_invalid, r_pre_divbyzero, r_pre_flush;
+    reg r_ftz;
+    int r_exp;
+
+    assign busy = (iter_left != 0);
+
+    wire pow2_divisor = (mant_b_div == {1'b1, 23'b0});
+    wire [QUOT_BITS:0] quotient;        // floor(mant_a * 2^QUOT_BITS / mant_b) once done
+    wire rem_nonzero;                   // the division is inexact
+    wire exact_early;                   // restoring remainder already zero, remaining digits 0
+
+    generate
+        if (SRT == 0) begin : restoring
+            reg [QUOT_BITS:0] quot;
+            reg [25:0] remainder;
+            reg [25:0] divisor;
+
+            // quotient digit selection: largest q in {0,1,2,3} with q * divisor <= 4 * remainder
+            wire [25:0] rem_x4 = remainder << 2;
+            wire [25:0] divisor_x2 = divisor << 1;
+            wire [25:0] divisor_x3 = divisor + divisor_x2;
+            reg [1:0] q_digit;
+            reg [25:0] rem_next;
+
+            always @(*) begin
+                if (rem_x4 >= divisor_x3) begin q_digit = 2'd3; rem_next = rem_x4 - divisor_x3; end
+                else if (rem_x4 >= divisor_x2) begin q_digit = 2'd2; rem_next = rem_x4 - divisor_x2; end
+                else if (rem_x4 >= divisor) begin q_digit = 2'd1; rem_next = rem_x4 - divisor; end
+                else begin q_digit = 2'd0; rem_next = rem_x4; end
+            end
+
+            always @(posedge clk) begin
+                if (start && !busy) begin
+                    divisor <= {2'b0, mant_b_div};
+                    if (pow2_divisor) begin
+                        // power-of-two divisor: quotient is the dividend
+                        quot <= {mant_a_div, 3'b0};
+                        remainder <= '0;
+                    end else begin
+                        // integer quotient bit
+                        quot <= {{QUOT_BITS{1'b0}}, (mant_a_div >= mant_b_div)};
+                        remainder <= (mant_a_div >= mant_b_div) ? {2'b0, mant_a_div - mant_b_div} : {2'b0, mant_a_div};
+                    end
+                end else if (busy) begin
+                    if (remainder == 0) quot <= quot << (2 * iter_left);
+                    else begin
+                        quot <= {quot[QUOT_BITS-2:0], q_digit};
+                        remainder <= rem_next;
                     end
                 end
-                if (is_b_denormal) begin
-                    for (int i = 23 ; i > 0 ; i--) begin
-                        if (!mant_b_div[23]) begin exp_diff += 1; mant_b_div <<= 1; end
-                        else begin i = 0; end
+            end
+
+            assign quotient = quot;
+            assign rem_nonzero = (remainder != 0);
+            assign exact_early = (remainder == 0);
+        end else begin : srt
+            // w = ws + wc, two's complement with 4 integer bits and 25 fraction bits; w0 = mant_a / 4
+            // and every step keeps |w| <= 2/3 * divisor
+            localparam W = 29;
+            localparam Q_W = 2 * (QUOT_BITS / 2 + 1);
+            reg [W-1:0] ws, wc;
+            reg [W-1:0] divisor;
+            reg [2:0] d_idx;                // divisor bits below the leading 1
+            reg [Q_W-1:0] q_pos, q_neg;     // quotient so far, and quotient - 1
+
+            // digit for the shifted remainder estimate y (1/16 units): 2, 1, 0, -1 or -2 at or above
+            // the thresholds of the divisor interval [1 + d_idx/8, 1 + (d_idx+1)/8)
+            function automatic signed [2:0] srt_digit(input [2:0] d, input signed [7:0] y);
+                reg signed [7:0] m2, m1, m0, mn1;
+                case (d)
+                    3'd0: {m2, m1, m0, mn1} = {8'sd24, 8'sd6,  -8'sd10, -8'sd26};
+                    3'd1: {m2, m1, m0, mn1} = {8'sd27, 8'sd7,  -8'sd12, -8'sd30};
+                    3'd2: {m2, m1, m0, mn1} = {8'sd30, 8'sd8,  -8'sd13, -8'sd33};
+                    3'd3: {m2, m1, m0, mn1} = {8'sd32, 8'sd8,  -8'sd14, -8'sd36};
+                    3'd4: {m2, m1, m0, mn1} = {8'sd35, 8'sd9,  -8'sd16, -8'sd40};
+                    3'd5: {m2, m1, m0, mn1} = {8'sd38, 8'sd10, -8'sd17, -8'sd43};
+                    3'd6: {m2, m1, m0, mn1} = {8'sd40, 8'sd10, -8'sd18, -8'sd46};
+                    default: {m2, m1, m0, mn1} = {8'sd43, 8'sd11, -8'sd20, -8'sd50};
+                endcase
+                if (y >= m2) srt_digit = 3'sd2;
+                else if (y >= m1) srt_digit = 3'sd1;
+                else if (y >= m0) srt_digit = 3'sd0;
+                else if (y >= mn1) srt_digit = -3'sd1;
+                else srt_digit = -3'sd2;
+            endfunction
+
+            wire [W-1:0] ws_x4 = ws << 2;
+            wire [W-1:0] wc_x4 = wc << 2;
+            wire signed [7:0] y_est = ws_x4[W-1 -: 8] + wc_x4[W-1 -: 8];
+            wire signed [2:0] q_digit = srt_digit(d_idx, y_est);
+
+            // 4w - q * divisor: -q * divisor enters as its complement, the +1 in the free carry lsb
+            wire [W-1:0] q_mult = (q_digit == 3'sd2 || q_digit == -3'sd2) ? (divisor << 1) : (q_digit == 3'sd0) ? '0 : divisor;
+            wire q_pos_digit = !q_digit[2] && q_digit != 3'sd0;
+            wire [W-1:0] t = q_pos_digit ? ~q_mult : q_mult;
+            wire [W-1:0] ws_next = ws_x4 ^ wc_x4 ^ t;
+            wire [W-1:0] wc_next = (((ws_x4 & wc_x4) | (ws_x4 & t) | (wc_x4 & t)) << 1) | W'(q_pos_digit);
+            wire [1:0] q_bits = q_digit[1:0];                       // q mod 4
+            wire [1:0] q_bits_m1 = 2'(q_digit - 3'sd1);            // (q - 1) mod 4
+
+            always @(posedge clk) begin
+                if (start && !busy) begin
+                    divisor <= {3'b0, mant_b_div, 2'b0};
+                    d_idx <= mant_b_div[22:20];
+                    wc <= '0;
+                    q_neg <= '1;
+                    if (pow2_divisor) begin
+                        // power-of-two divisor: quotient is the dividend
+                        q_pos <= Q_W'({mant_a_div, 3'b0});
+                        ws <= '0;
+                    end else begin
+                        q_pos <= '0;
+                        ws <= {5'b0, mant_a_div};
                     end
+                end else if (busy) begin
+                    ws <= ws_next;
+                    wc <= wc_next;
+                    q_pos <= {q_digit[2] ? q_neg[Q_W-3:0] : q_pos[Q_W-3:0], q_bits};
+                    q_neg <= {q_pos_digit ? q_pos[Q_W-3:0] : q_neg[Q_W-3:0], q_bits_m1};
                 end
-            
-            if (mant_a_div < mant_b_div) begin exp_diff -= 1; end // carry
+            end
 
-            // --- 2b. Division ---
-            dividend = {mant_a_div, {div_precision{1'b0}}};
-            divisor = {{div_precision{1'b0}}, mant_b_div};
-            quotient[div_precision + 23:0] = dividend / divisor;
+            // final remainder: negative means the last digits overshot by one unit
+            wire [W-1:0] w_final = ws + wc;
+            assign quotient = w_final[W-1] ? q_neg[QUOT_BITS:0] : q_pos[QUOT_BITS:0];
+            assign rem_nonzero = (w_final != 0);
+            assign exact_early = 1'b0;
+        end
+    endgenerate
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            iter_left <= '0;
+            done <= 1'b0;
+        end else if (start && !busy) begin
+            r_normal <= normal_path_enable;
+            r_sign <= pre_sign;
+            r_rounding_mode <= rounding_mode;
+            r_pre_exp <= pre_exp; r_pre_mant <= pre_mant;
+            r_pre_invalid <= pre_invalid; r_pre_divbyzero <= pre_divbyzero; r_pre_flush <= pre_flush;
+            r_ftz <= ftz;
+            r_exp <= exp_diff;
+            r_cov <= cov_setup;
 
-            // --- 2c. Post-Division leading zero ---
-            for (;!quotient[div_precision + 23];) begin
-                quotient <<= 1;
+            if (!normal_path_enable || pow2_divisor) begin
+                // special values, ftz underflows and power-of-two divisors finish immediately
+                iter_left <= '0; done <= 1'b1;
+            end else begin
+                iter_left <= 5'(ITERATIONS); done <= 1'b0;
+            end
+        end else if (busy) begin
+            if (exact_early) begin
+                iter_left <= '0; done <= 1'b1;
+                r_cov[CV_EXACT_EARLY] <= 1'b1;
+            end else begin
+                iter_left <= iter_left - 1;
+                done <= (iter_left == 1);
             end
-            
-            // --- 2d. Rounding Logic ---
-            lsb = quotient[div_precision];
-            g_bit = quotient[div_precision-1];
-            r_bit = quotient[div_precision-2];
-            s_bit = |quotient[div_precision-3:0];
+        end
+    end
+
+    // --- 3. Rounding / Result ---
+    // quot_norm: leading 1 at 26, result mantissa [26:3], guard 2, round 1, sticky 0
+    reg [26:0] quot_norm;
+    reg [24:0] quot_mant;
+    reg lsb, g_bit, r_bit, s_bit, round_up, tiny;
+    int exp_out;
+    wire flush = r_ftz || !DENORMALS;
+
+    always @(*) begin
+        // init
+        flag_invalid=0; flag_divbyzero=0; flag_overflow=0; flag_underflow=0; flag_inexact=0;
+        final_sign = r_sign; final_exp = r_pre_exp; final_mant = r_pre_mant;
+        quot_norm = '0; quot_mant = '0; exp_out = r_exp;
+        lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0; tiny = 0;
+        cov_round = '0;
+
+        if (!r_normal) begin
+            flag_invalid = r_pre_invalid; flag_divbyzero = r_pre_divbyzero;
+            flag_underflow = r_pre_flush; flag_inexact = r_pre_flush;
+        end else begin
+            // --- 3a. Post-Division leading zero ---
+            if (quotient[QUOT_BITS]) begin
+                quot_norm = {quotient[QUOT_BITS:1], quotient[0] | rem_nonzero};
+            end else begin
+                quot_norm = {quotient[QUOT_BITS-1:0], rem_nonzero};
+                cov_round[CV_QUOT_LT1] = 1;
+            end
+
+            // --- 3b. Tininess (after rounding, unbounded exponent) ---
+            tiny = (exp_out < 1);
+            if (exp_out == 0 && (&quot_norm[26:3])) tiny = !round_inc(r_rounding_mode, r_sign, quot_norm[3], quot_norm[2], quot_norm[1], quot_norm[0]);
+
+            // --- 3c. Put denormal back (tiny quotients flush below instead) ---
+            if (exp_out < 1 && !flush) begin
+                cov_round[CV_DENORM_OUT] = 1;
+                if (1 - exp_out > 25) begin
+                    quot_norm = {26'(0), |quot_norm};
+                end else begin
+                    s_bit = |(quot_norm & ((27'(1) << (1 - exp_out)) - 1));
+                    quot_norm = (quot_norm >> (1 - exp_out)) | {26'(0), s_bit};
+                end
+                exp_out = 0;
+            end
+
+            // --- 3d. Rounding Logic ---
+            lsb = quot_norm[3]; g_bit = quot_norm[2]; r_bit = quot_norm[1]; s_bit = quot_norm[0];
             flag_inexact = g_bit | r_bit | s_bit;
-            case (rounding_mode)
-                3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
-                3'b001: round_up = 1'b0; // RTZ
-                3'b010: round_up = flag_inexact & sign_a_dec; // RDN
-                3'b011: round_up = flag_inexact & ~sign_a_dec; // RUP
-                3'b100: round_up = flag_inexact; //RMM
-                default: round_up = 1'b0;
-            endcase
-            if (round_up) begin quotient += {24'b0, 1'b1, {div_precision{1'b0}}}; end
-            if (quotient[div_precision + 24]) begin
-                quotient >>= 1;
-                exp_diff += 1;
+            round_up = round_inc(r_rounding_mode, r_sign, lsb, g_bit, r_bit, s_bit);
+            cov_round[CV_RNE_UP +: 4] = round_up ? {r_rounding_mode == 3'b100, r_rounding_mode == 3'b011, r_rounding_mode == 3'b010, r_rounding_mode == 3'b000} : 4'b0;
+            quot_mant = {1'b0, quot_norm[26:3]} + {24'(0), round_up};
+            if (quot_mant[24]) begin
+                cov_round[CV_ROUND_CARRY] = 1;
+                quot_mant >>= 1;
+                exp_out += 1;
             end
+            if (exp_out == 0 && quot_mant[23] && !flush) exp_out = 1; // denormal rounded up to min normal
 
             // OF / UF
-            if (exp_diff < -23) begin
-                normal_path_enable = 0;
-                flag_underflow = 1;
-                flag_inexact = 1;
-                final_exp = '0; final_mant = '0; // 0
-            end
-            else if (exp_diff > 254) begin
-                normal_path_enable = 0;
+            if (exp_out > 254) begin
                 flag_overflow = 1;
                 flag_inexact = 1;
-                final_exp = '1; final_mant = '0; // Inf
+                if (r_rounding_mode == 3'b001 || (r_rounding_mode == 3'b010 && !r_sign) || (r_rounding_mode == 3'b011 && r_sign)) begin
+                    final_exp = {{7{1'b1}}, 1'b0}; final_mant = '1; // max normal
+                end else begin
+                    final_exp = '1; final_mant = '0; // Inf
+                end
+                cov_round[CV_OVERFLOW] = 1;
             end
-
-            if (normal_path_enable) begin
-                // put denormal back
-                for (; exp_diff < 0 ; exp_diff++) begin quotient >>= 1; end
-
-                // result
-                final_exp = exp_diff[7:0];
-                final_mant = quotient[div_precision + 23 : div_precision];
+            else if (flush && tiny) begin
+                flag_underflow = 1; flag_inexact = 1;
+                cov_round[CV_UNDERFLOW_ZERO] = 1;
+                final_exp = '0; final_mant = '0; // zero of the quotient's sign
+            end
+            else begin
+                flag_underflow = tiny & flag_inexact;
+                cov_round[CV_UNDERFLOW_ZERO] = (exp_out == 0) && (quot_mant == 0);
+                final_exp = exp_out[7:0];
+                final_mant = quot_mant[23:0];
             end
+            cov_round[CV_EXACT] = !flag_inexact;
         end
     end
 endmodule
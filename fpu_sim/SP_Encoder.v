@@ -4,5 +4,5 @@ module SP_Encoder (
     input  [23:0] mantissa_in,
     output [31:0] fp_out
 );
-    assign fp_out = {sign_in, exponent_in, mantissa_in[22:0]};
+    FP_Encoder #(.EXP_W(8), .MAN_W(23)) encoder ( .sign_in(sign_in), .exponent_in(exponent_in), .mantissa_in(mantissa_in), .fp_out(fp_out) );
 endmodule
@@ -0,0 +1,24 @@
+module SP_FMA #(
+    parameter STAGES = 0,               // Pipeline registers (0-4): the product tree, then the rounding
+    parameter DENORMALS = 1             // 0: FTZ / DAZ on every op, no denormal normalize or shift
+) (
+    input           clk,
+    input           hold,               // Freeze the pipeline (result not taken)
+    input [31:0]    operand_a,
+    input [31:0]    operand_b,
+    input [31:0]    operand_c,
+    input           negate_product,     // -(a*b), FNMADD / FNMSUB
+    input           negate_addend,      // -c, FMSUB / FNMADD
+    input [2:0]     rounding_mode,
+    input           ftz,                // Denormal operands read as zero, tiny results flush to zero
+    output [31:0]   result,
+    output          flag_invalid,
+    output          flag_overflow,
+    output          flag_underflow,
+    output          flag_inexact,
+    output [17:0]   cov                 // Corner paths this op took, bin n on bit n (fpu_cov.h)
+);
+
+    FP_FMA #(.EXP_W(8), .MAN_W(23), .STAGES(STAGES), .DENORMALS(DENORMALS)) fma ( .clk(clk), .hold(hold), .operand_a(operand_a), .operand_b(operand_b), .operand_c(operand_c), .negate_product(negate_product), .negate_addend(negate_addend), .rounding_mode(rounding_mode), .narrow_exp(1'b0), .narrow_man(1'b0), .ftz(ftz), .result(result), .flag_invalid(flag_invalid), .flag_overflow(flag_overflow), .flag_underflow(flag_underflow), .flag_inexact(flag_inexact), .cov(cov) );
+
+endmodule
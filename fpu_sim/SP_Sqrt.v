@@ -0,0 +1,225 @@
+module SP_Sqrt #(
+    parameter DENORMALS = 1     // 0: denormal operands always read as zero, no normalize hardware
+) (
+    input clk,
+    input rst_n,
+    input start,                // Latch operand and begin a square root (ignored while busy)
+    input [31:0] operand_a,
+    input [2:0]  rounding_mode,
+    input        ftz,           // A denormal operand reads as zero (a root is never tiny)
+    output       busy,          // Root digits are being produced
+    output reg   done,          // Result and flags valid, held until the next start
+    output reg [31:0] result,
+    output reg       flag_invalid,
+    output reg       flag_inexact,
+    output [10:0]    cov        // Corner paths this op took, bin n on bit n (fpu_cov.h)
+);
+    // --- Coverage bins ---
+    localparam CV_INVALID = 0, CV_INF = 1, CV_ZERO = 2, CV_DENORM_IN = 3, CV_ODD_EXP = 4, CV_EXACT_EARLY = 5;
+    localparam CV_RNE_UP = 6;           // RNE, RUP, RMM rounded up: 6..8 (RTZ and RDN never do)
+    localparam CV_ROUND_CARRY = 9, CV_EXACT = 10;
+    reg [10:0] cov_setup, r_cov, cov_round;    // setup bins, as latched on start, rounding bins
+    assign cov = r_cov | cov_round;
+
+    // operand a
+    reg sign_a_dec;
+    reg [7:0] exp_a_dec;
+    reg [23:0] mant_a_dec;
+    reg is_a_zero, is_a_infinity, is_a_nan, is_a_denormal;
+
+    // result
+    reg final_sign;
+    reg [7:0] final_exp;
+    reg [23:0] final_mant;
+
+    // Decode / Encode
+    SP_Decoder decoder_a ( .fp_in(operand_a), .daz(ftz || !DENORMALS), .sign_out(sign_a_dec), .exponent_out(exp_a_dec), .mantissa_out(mant_a_dec), .is_zero(is_a_zero), .is_infinity(is_a_infinity), .is_nan(is_a_nan), .is_denormal(is_a_denormal) );
+    SP_Encoder encoder ( .sign_in(final_sign), .exponent_in(final_exp), .mantissa_in(final_mant), .fp_out(result) );
+
+    // root = floor(sqrt(radicand)) covers the 24 mantissa bits + guard + round;
+    // everything below is folded into sticky through the final remainder.
+    localparam ROOT_BITS = 26;
+    localparam ITERATIONS = ROOT_BITS / 2;
+
+    // local variables
+    reg normal_path_enable;
+    reg pre_sign;
+    reg [7:0] pre_exp;
+    reg [23:0] pre_mant;
+    reg pre_invalid;
+
+    int exp_eff, exp_root;
+    reg exp_odd;
+    reg [23:0] mant_a_sqrt;
+    reg [2*ROOT_BITS-1:0] radicand_init;
+
+    // --- Denormal pre-normalization ---
+    wire [4:0] lz_a;
+    wire [23:0] mant_a_norm;
+
+    // without DENORMALS the operand never decodes as a denormal
+    generate
+        if (DENORMALS) begin : denorm_in
+            LZC #(.WIDTH(24)) lzc_a ( .data_in(mant_a_dec), .count(lz_a) );
+            Barrel_Shifter #(.WIDTH(24), .SHIFT_W(5)) norm_a ( .data_in(mant_a_dec), .shift_amt(lz_a), .shift_right(1'b0), .data_out(mant_a_norm) );
+        end else begin : no_denorm_in
+            assign lz_a = '0;
+            assign mant_a_norm = mant_a_dec;
+        end
+    endgenerate
+
+    // --- 1. Operand Setup (sampled on start) ---
+    always @(*) begin
+        // init
+        pre_invalid=0;
+        normal_path_enable = 1;
+        cov_setup = '0;
+        pre_exp = '0; pre_mant = '0;
+
+        // --- 1a. Special Value Handling ---
+        pre_sign = sign_a_dec;
+        if (is_a_nan || (sign_a_dec && !is_a_zero)) begin
+            normal_path_enable = 0; pre_invalid = 1; pre_sign = 0; pre_exp = '1; pre_mant = {2'b11, 22'b0}; // NAN
+        end else if (is_a_infinity) begin
+            normal_path_enable = 0; pre_exp = '1; pre_mant = '0; // Inf
+        end else if (is_a_zero) begin
+            normal_path_enable = 0; pre_exp = '0; pre_mant = '0; // +-0
+        end
+
+        // init
+        exp_eff = is_a_denormal ? 1 : {24'b0, exp_a_dec};
+        mant_a_sqrt = mant_a_dec;
+
+        // --- 1b. Exponent ---
+            // denormal
+            if (is_a_denormal) begin mant_a_sqrt = mant_a_norm; exp_eff -= int'(lz_a); end
+
+        // an odd unbiased exponent moves one factor of 2 into the radicand
+        exp_odd = !exp_eff[0];
+        exp_root = (exp_eff + 127 - (exp_odd ? 1 : 0)) / 2;
+        radicand_init = exp_odd ? {mant_a_sqrt, 28'b0} : {1'b0, mant_a_sqrt, 27'b0};
+
+        // coverage
+        cov_setup[CV_INVALID] = pre_invalid;
+        cov_setup[CV_INF] = !normal_path_enable && !pre_invalid && is_a_infinity;
+        cov_setup[CV_ZERO] = !normal_path_enable && !pre_invalid && is_a_zero;
+        cov_setup[CV_DENORM_IN] = normal_path_enable && is_a_denormal;
+        cov_setup[CV_ODD_EXP] = normal_path_enable && exp_odd;
+    end
+
+    // --- 2. Radix-4 Square Root ---
+    // Restoring digit recurrence, two root bits per cycle.
+    reg [ROOT_BITS-1:0] root;
+    reg [ROOT_BITS+1:0] remainder;
+    reg [2*ROOT_BITS-1:0] radicand;
+    reg [4:0] iter_left;
+
+    reg r_normal;
+    reg r_sign;
+    reg [2:0] r_rounding_mode;
+    reg [7:0] r_pre_exp;
+    reg [23:0] r_pre_mant;
+    reg r_pre_invalid;
+    int r_exp;
+
+    assign busy = (iter_left != 0);
+
+    // two root bits: append the next radicand pair and subtract 4*root+1 when it fits
+    reg [ROOT_BITS+1:0] rem_s1, rem_s2;
+    reg [ROOT_BITS-1:0] root_s1, root_s2;
+
+    always @(*) begin
+        rem_s1 = {remainder[ROOT_BITS-1:0], radicand[2*ROOT_BITS-1 -: 2]};
+        if (rem_s1 >= {root, 2'b01}) begin rem_s1 = rem_s1 - {root, 2'b01}; root_s1 = {root[ROOT_BITS-2:0], 1'b1}; end
+        else begin root_s1 = {root[ROOT_BITS-2:0], 1'b0}; end
+
+        rem_s2 = {rem_s1[ROOT_BITS-1:0], radicand[2*ROOT_BITS-3 -: 2]};
+        if (rem_s2 >= {root_s1, 2'b01}) begin rem_s2 = rem_s2 - {root_s1, 2'b01}; root_s2 = {root_s1[ROOT_BITS-2:0], 1'b1}; end
+        else begin root_s2 = {root_s1[ROOT_BITS-2:0], 1'b0}; end
+    end
+
+    always @(posedge clk or negedge rst_n) begin
+        if (!rst_n) begin
+            iter_left <= '0;
+            done <= 1'b0;
+        end else if (start && !busy) begin
+            r_normal <= normal_path_enable;
+            r_sign <= pre_sign;
+            r_rounding_mode <= rounding_mode;
+            r_pre_exp <= pre_exp; r_pre_mant <= pre_mant;
+            r_pre_invalid <= pre_invalid;
+            r_exp <= exp_root;
+            r_cov <= cov_setup;
+            root <= '0;
+            remainder <= '0;
+            radicand <= radicand_init;
+
+            if (!normal_path_enable) begin
+                // special values finish immediately
+                iter_left <= '0; done <= 1'b1;
+            end else begin
+                iter_left <= 5'(ITERATIONS); done <= 1'b0;
+            end
+        end else if (busy) begin
+            if (remainder == 0 && radicand == 0) begin
+                // exact: the remaining digits are all zero
+                root <= root << (2 * iter_left);
+                iter_left <= '0; done <= 1'b1;
+                r_cov[CV_EXACT_EARLY] <= 1'b1;
+            end else begin
+                root <= root_s2;
+                remainder <= rem_s2;
+                radicand <= radicand << 4;
+                iter_left <= iter_left - 1;
+                done <= (iter_left == 1);
+            end
+        end
+    end
+
+    // --- 3. Rounding / Result ---
+    reg [24:0] root_mant;
+    reg lsb, g_bit, r_bit, s_bit, round_up;
+    int exp_out;
+
+    always @(*) begin
+        // init
+        flag_invalid=0; flag_inexact=0;
+        final_sign = r_sign; final_exp = r_pre_exp; final_mant = r_pre_mant;
+        root_mant = '0; exp_out = r_exp;
+        lsb = 0; g_bit = 0; r_bit = 0; s_bit = 0; round_up = 0;
+        cov_round = '0;
+
+        if (!r_normal) begin
+            flag_invalid = r_pre_invalid;
+        end else begin
+            // root[25] is always set: the radicand is at least 2^50
+            root_mant = {1'b0, root[ROOT_BITS-1:2]};
+            lsb = root[2]; g_bit = root[1]; r_bit = root[0];
+            s_bit = (remainder != 0);
+
+            // --- 3a. Rounding Logic ---
+            // the root of a non-zero operand is positive and never exactly halfway
+            flag_inexact = g_bit | r_bit | s_bit;
+            case (r_rounding_mode)
+                3'b000: round_up = g_bit & (lsb | r_bit | s_bit); // RNE
+                3'b001: round_up = 1'b0; // RTZ
+                3'b010: round_up = 1'b0; // RDN
+                3'b011: round_up = flag_inexact; // RUP
+                3'b100: round_up = g_bit; // RMM
+                default: round_up = 1'b0;
+            endcase
+            if (round_up) begin root_mant += 1; end
+            cov_round[CV_RNE_UP +: 3] = round_up ? {r_rounding_mode == 3'b100, r_rounding_mode == 3'b011, r_rounding_mode == 3'b000} : 3'b0;
+            if (root_mant[24]) begin
+                cov_round[CV_ROUND_CARRY] = 1;
+                root_mant >>= 1;
+                exp_out += 1;
+            end
+
+            // the root of any finite operand is a normal number, no OF / UF
+            final_exp = exp_out[7:0];
+            final_mant = root_mant[23:0];
+            cov_round[CV_EXACT] = !flag_inexact;
+        end
+    end
+endmodule
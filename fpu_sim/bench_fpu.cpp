@@ -0,0 +1,332 @@
+#include <iostream>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <map>
+
+// Verilator header
+#include "verilated.h"
+
+// FPU Top module header
+#include "VFPU_Top.h"
+#include "fpu_opcodes.h"
+#include "fpu_gen.h"
+#include "fpu_cov.h"
+
+// Throughput / latency benchmark: issues a weighted random op mix back to back for as many
+// cycles as it takes, then reports cycles per op, per-opcode latency and host speed as JSON.
+//
+//   obj_bench/VFPU_Top [--ops N] [--mix op:weight,...] [--dist random|normal|denormal|coverage]
+//                      [--seed S] [--json file] [--toggles file [--toggle-baseline file]]
+//
+// --dist coverage draws ops, rounding modes and operands from a CovGuide (fpu_cov.h) fed by
+// cov_out, so the stream keeps steering toward corner paths not yet taken; it needs a model
+// built with COVERAGE=1 and adds the bins reached to the JSON report.
+//
+// Built with --coverage-toggle (make activity), --toggles also sums the toggle counts of every
+// unit instance into a text file and the JSON report; --toggle-baseline prints them next to an
+// earlier run's file.
+
+// --- Operand Generation (fpu_gen.h) ---
+std::mt19937_64 rng;
+
+// --- Per-Opcode Statistics ---
+const int LATENCY_BUCKETS = 1024;   // the last bucket collects everything longer
+
+struct OpStats {
+    uint64_t count = 0;
+    uint64_t latency_sum = 0;
+    uint64_t latency_max = 0;
+    std::vector<uint64_t> histogram = std::vector<uint64_t>(LATENCY_BUCKETS, 0);
+
+    void record(uint64_t latency) {
+        count++;
+        latency_sum += latency;
+        if (latency > latency_max) latency_max = latency;
+        histogram[latency < LATENCY_BUCKETS ? latency : LATENCY_BUCKETS - 1]++;
+    }
+    uint64_t percentile(double p) const {
+        uint64_t target = (uint64_t)(p * count + 0.999999);
+        uint64_t seen = 0;
+        for (int i = 0; i < LATENCY_BUCKETS; i++) {
+            seen += histogram[i];
+            if (seen >= target && seen > 0) return i;
+        }
+        return latency_max;
+    }
+};
+
+// --- Toggle Activity ---
+// Verilator coverage lines look like  C '<\001key\002value ...>' count ; toggle points have a
+// page of v_toggle/<module> and their instance path in key h. Counts are summed per instance
+// directly below FPU_Top, signals of FPU_Top itself under "FPU_Top".
+std::map<std::string, uint64_t> toggle_totals(const std::string& path) {
+    std::map<std::string, uint64_t> totals;
+    std::ifstream in(path);
+    std::string line;
+    while (std::getline(in, line)) {
+        size_t end = line.rfind('\'');
+        if (line.compare(0, 3, "C '") != 0 || end < 3) continue;
+        std::string keys = line.substr(3, end - 3);
+        if (keys.find("\001page\002v_toggle") == std::string::npos) continue;
+        size_t h = keys.find("\001h\002");
+        if (h == std::string::npos) continue;
+        std::string hier = keys.substr(h + 3, keys.find('\001', h + 3) - (h + 3));
+        size_t top = hier.find("FPU_Top");
+        std::string instance = "FPU_Top";
+        if (top != std::string::npos && top + 8 < hier.size()) {
+            instance = hier.substr(top + 8);
+            instance = instance.substr(0, instance.find('.'));
+        }
+        totals[instance] += std::strtoull(line.c_str() + end + 1, nullptr, 10);
+    }
+    return totals;
+}
+
+// simulate clock
+vluint64_t main_time = 0;
+double sc_time_stamp() {
+    return main_time;
+}
+
+// --- Pipeline Configuration (Must match FPU_Top.v) ---
+const int TAG_WIDTH = 8;
+const int NUM_TAGS = 1 << TAG_WIDTH;
+const int DRAIN_TIMEOUT = 1000;
+
+uint64_t eval_count = 0;
+
+// advance one clock cycle
+void tick(VFPU_Top* top) {
+    top->clk = 0;
+    top->eval();
+    main_time++;
+
+    top->clk = 1;
+    top->eval();
+    main_time++;
+    eval_count += 2;
+}
+
+int main(int argc, char** argv, char** env) {
+    // initialize Verilator
+    Verilated::commandArgs(argc, argv);
+
+    // --- Options ---
+    uint64_t num_ops = 1000000;
+    std::string mix = "all";
+    std::string dist_name = "random";
+    uint64_t seed = 1;
+    std::string json_path;
+    std::string toggles_path, baseline_path;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string opt = argv[i];
+        if (opt == "--ops") num_ops = std::strtoull(argv[i + 1], nullptr, 0);
+        else if (opt == "--mix") mix = argv[i + 1];
+        else if (opt == "--dist") dist_name = argv[i + 1];
+        else if (opt == "--seed") seed = std::strtoull(argv[i + 1], nullptr, 0);
+        else if (opt == "--json") json_path = argv[i + 1];
+        else if (opt == "--toggles") toggles_path = argv[i + 1];
+        else if (opt == "--toggle-baseline") baseline_path = argv[i + 1];
+        else {
+            std::cerr << "Unknown option: " << opt << std::endl;
+            return 2;
+        }
+    }
+    Distribution dist;
+    bool guided = dist_name == "coverage";     // operands from the CovGuide below
+    if (dist_name == "random" || guided) dist = DIST_RANDOM;
+    else if (dist_name == "normal") dist = DIST_NORMAL;
+    else if (dist_name == "denormal") dist = DIST_DENORMAL;
+    else {
+        std::cerr << "Unknown distribution: " << dist_name << std::endl;
+        return 2;
+    }
+    std::vector<double> weights;
+    if (!parse_op_mix(mix, weights)) return 2;
+    rng.seed(seed);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+
+    // initialize FPU
+    VFPU_Top* top = new VFPU_Top;
+
+    // reset
+    top->rst_n = 0;
+    top->in_valid = 0;
+    tick(top);
+    top->rst_n = 1;
+
+    // run: offer a new op every cycle, time each one from acceptance to its result by tag
+    std::vector<int> in_flight(NUM_TAGS, -1);           // tag -> op_table index
+    std::vector<CovSeed> in_flight_seed(NUM_TAGS);      // tag -> guided op, for its cov_out
+    std::vector<uint64_t> issue_cycle(NUM_TAGS, 0);
+    std::vector<OpStats> stats(op_table.size());
+    uint64_t issued = 0;
+    uint64_t completed = 0;
+    uint64_t cycle = 0;
+    uint64_t stall_cycles = 0;          // op offered but not accepted
+    uint32_t next_tag = 0;
+    int idle_cycles = 0;
+    CovGuide guide(weights, {RNE, RTZ, RDN, RUP, RMM}, 0.5, 0);
+    CovSeed next_seed = guided ? guide.next(rng) : CovSeed();
+    size_t next_op = guided ? next_seed.op : pick(rng);
+
+    auto host_start = std::chrono::steady_clock::now();
+    while (completed < num_ops && idle_cycles < DRAIN_TIMEOUT) {
+        // setting inputs
+        bool issue = (issued < num_ops) && (in_flight[next_tag] < 0);
+        top->in_valid = issue;
+        if (issue) {
+            const OpInfo& op = op_table[next_op];
+            top->in_tag = next_tag;
+            top->func7 = op.func7;
+            if (guided) {
+                top->func3 = next_seed.func3;
+                top->rs2 = next_seed.rs2;
+                top->operand_a = next_seed.a;
+                top->operand_b = next_seed.b;
+                top->operand_c = next_seed.c;
+            } else {
+                top->func3 = op.compare ? rng() % 3 : rng() % 5;
+                top->rs2 = op.max_rs2 ? rng() % (op.max_rs2 + 1) : 0;
+                top->operand_a = gen_operand(rng, op.format, dist);
+                top->operand_b = gen_operand(rng, op.format, dist);
+                top->operand_c = gen_operand(rng, op.format, dist);
+            }
+        }
+        top->eval();
+        eval_count++;
+        bool accepted = issue && top->in_ready;
+        if (issue && !accepted) stall_cycles++;
+
+        tick(top);
+        cycle++;
+
+        if (accepted) {
+            in_flight[next_tag] = next_op;
+            in_flight_seed[next_tag] = next_seed;
+            issue_cycle[next_tag] = cycle;
+            next_tag = (next_tag + 1) % NUM_TAGS;
+            issued++;
+            if (guided) {
+                next_seed = guide.next(rng);
+                next_op = next_seed.op;
+            } else {
+                next_op = pick(rng);
+            }
+        }
+
+        // completion
+        idle_cycles++;
+        if (top->out_valid) {
+            int index = in_flight[top->out_tag];
+            if (index < 0) {
+                std::cerr << "Unexpected result for tag " << (int)top->out_tag << std::endl;
+                break;
+            }
+            stats[index].record(cycle - issue_cycle[top->out_tag]);
+            if (guided) guide.observe(in_flight_seed[top->out_tag], top->cov_out);
+            in_flight[top->out_tag] = -1;
+            completed++;
+            idle_cycles = 0;
+        }
+    }
+    double host_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - host_start).count();
+    std::vector<uint64_t> counters = read_perf_counters(top);
+    top->final();
+
+    // --- Toggle Totals ---
+    std::map<std::string, uint64_t> toggles;
+    if (!toggles_path.empty()) {
+#if VM_COVERAGE
+        std::string dat = toggles_path + ".dat";
+        Verilated::threadContextp()->coveragep()->write(dat.c_str());
+        toggles = toggle_totals(dat);
+        std::ofstream out(toggles_path);
+        for (const auto& t : toggles) out << t.first << " " << t.second << "\n";
+#else
+        std::cerr << "Built without --coverage-toggle, use make activity for --toggles" << std::endl;
+#endif
+    }
+    if (!baseline_path.empty() && !toggles.empty()) {
+        std::map<std::string, uint64_t> base;
+        std::ifstream in(baseline_path);
+        std::string name;
+        uint64_t count;
+        while (in >> name >> count) base[name] = count;
+        uint64_t base_sum = 0, sum = 0;
+        std::cout << std::left << std::setw(24) << "instance" << std::right << std::setw(14) << "baseline" << std::setw(14) << "toggles" << std::setw(10) << "change" << std::endl;
+        for (const auto& t : toggles) {
+            uint64_t b = base.count(t.first) ? base[t.first] : 0;
+            base_sum += b;
+            sum += t.second;
+            std::cout << std::left << std::setw(24) << t.first << std::right << std::setw(14) << b << std::setw(14) << t.second
+                      << std::setw(9) << std::fixed << std::setprecision(1) << (b ? 100.0 * ((double)t.second - b) / b : 0.0) << "%" << std::endl;
+        }
+        std::cout << std::left << std::setw(24) << "total" << std::right << std::setw(14) << base_sum << std::setw(14) << sum
+                  << std::setw(9) << (base_sum ? 100.0 * ((double)sum - base_sum) / base_sum : 0.0) << "%" << std::endl;
+        std::cout.unsetf(std::ios::fixed);
+        std::cout << std::setprecision(6);
+    }
+    delete top;
+
+    // --- JSON Report ---
+    std::ostringstream json;
+    json << "{\n";
+    json << "  \"config\": {\"ops\": " << num_ops << ", \"mix\": \"" << mix << "\", \"dist\": \"" << dist_name << "\", \"seed\": " << seed << "},\n";
+    json << "  \"completed\": " << completed << ",\n";
+    json << "  \"cycles\": " << cycle << ",\n";
+    json << "  \"stall_cycles\": " << stall_cycles << ",\n";
+    json << "  \"cycles_per_op\": " << (completed ? (double)cycle / completed : 0.0) << ",\n";
+    json << "  \"host\": {\"seconds\": " << host_seconds
+         << ", \"evals\": " << eval_count
+         << ", \"evals_per_sec\": " << (host_seconds > 0 ? eval_count / host_seconds : 0.0)
+         << ", \"ops_per_sec\": " << (host_seconds > 0 ? completed / host_seconds : 0.0) << "},\n";
+    if (!toggles.empty()) {
+        json << "  \"toggles\": {";
+        bool first_unit = true;
+        for (const auto& t : toggles) {
+            json << (first_unit ? "" : ", ") << "\"" << t.first << "\": " << t.second;
+            first_unit = false;
+        }
+        json << "},\n";
+    }
+    if (guided) {
+        json << "  \"coverage\": {\"reached\": " << guide.coverage.reached() << ", \"bins\": " << guide.coverage.bins()
+             << ", \"last_new_op\": " << guide.last_new << "},\n";
+    }
+    json << "  \"counters\": {";
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        json << (i ? ", " : "") << "\"" << perf_counter_names[i] << "\": " << counters[i];
+    }
+    json << "},\n";
+    json << "  \"ops\": {";
+    bool first = true;
+    for (size_t i = 0; i < op_table.size(); i++) {
+        const OpStats& s = stats[i];
+        if (s.count == 0) continue;
+        json << (first ? "\n" : ",\n") << "    \"" << op_table[i].name << "\": {"
+             << "\"count\": " << s.count
+             << ", \"latency_mean\": " << (double)s.latency_sum / s.count
+             << ", \"latency_p99\": " << s.percentile(0.99)
+             << ", \"latency_max\": " << s.latency_max << "}";
+        first = false;
+    }
+    json << "\n  }\n}\n";
+
+    if (json_path.empty()) {
+        std::cout << json.str();
+    } else {
+        std::ofstream out(json_path);
+        out << json.str();
+        std::cout << "Benchmark: " << completed << " ops in " << cycle << " cycles, report written to " << json_path << std::endl;
+    }
+
+    return (completed == num_ops) ? 0 : 1;
+}
@@ -0,0 +1,300 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <ostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "fpu_opcodes.h"
+#include "fpu_gen.h"
+
+// Functional coverage of the IEEE corner paths. With COVERAGE=1, FPU_Top's cov_out carries, for
+// every op it writes back, one bit per bin of the unit that ran it: bin n is the CV_* localparam
+// n in that unit's RTL and cov_units below names them in the same order. Packed ops OR the bins
+// of both lanes and 16-bit ops those of all four; the 16-bit add, multiply and FMA run the same
+// FP_* units as the wide ones and so report the same bins. Illegal ops carry no bins.
+const int COV_BINS_MAX = 24;            // width of cov_out
+
+struct CovUnit {
+    const char* name;
+    std::vector<const char*> bins;
+};
+
+#define COV_ADDER_BINS {"nan", "inf_minus_inf", "inf", "zero_operand", "exact_cancel", "denorm_in", "align_sticky", \
+                        "add_carry", "cancel_norm", "rne_up", "rdn_up", "rup_up", "rmm_up", "round_carry", "overflow", "underflow"}
+#define COV_MUL_BINS   {"invalid", "inf", "zero", "denorm_in", "early_overflow", "early_underflow", "prod_ge2", \
+                        "denorm_out", "denorm_sticky", "rne_up", "rdn_up", "rup_up", "rmm_up", "round_carry", "underflow", "exact"}
+#define COV_DIV_BINS   {"invalid", "div_by_zero", "inf_or_zero", "denorm_in", "pow2_divisor", "exact_early", "quot_lt1", \
+                        "rne_up", "rdn_up", "rup_up", "rmm_up", "round_carry", "overflow", "underflow_zero", "denorm_out", "exact"}
+#define COV_FMA_BINS   {"invalid", "inf", "zero_product", "exact_cancel", "denorm_in", "align_sticky", "addend_larger", \
+                        "add_carry", "tiny_check", "denorm_out", "rne_up", "rdn_up", "rup_up", "rmm_up", "round_carry", \
+                        "denorm_to_normal", "overflow_inf", "overflow_max"}
+#define COV_SQRT_BINS  {"invalid", "inf", "zero", "denorm_in", "odd_exp", "exact_early", "rne_up", "rup_up", "rmm_up", \
+                        "round_carry", "exact"}
+#define COV_CMP_BINS   {"nan", "snan", "both_zero", "sign_differs", "both_negative", "equal", "denorm_in", "eq_true", \
+                        "lt_true", "le_true"}
+
+// indexed like U_SP_ADD .. U_HP_CVT in FPU_Top.v
+const std::vector<CovUnit> cov_units = {
+    {"sp_add", COV_ADDER_BINS},
+    {"dp_add", COV_ADDER_BINS},
+    {"sp_cmp", COV_CMP_BINS},
+    {"dp_cmp", COV_CMP_BINS},
+    {"sp_cvt", {"nan", "inf", "zero", "denorm_in", "int_negative", "uint_negative", "frac", "frac_rounded",
+                "int_overflow", "int_min", "rne_up", "rdn_up", "rup_up", "rmm_up", "round_overflow"}},
+    {"dp_cvt", {"nan", "inf", "zero", "int_negative", "denorm_out", "underflow_zero", "near_max", "overflow",
+                "uint_negative", "frac", "frac_rounded", "int_overflow", "int_min", "rne_up", "rdn_up", "rup_up",
+                "rmm_up", "round_carry", "round_overflow"}},
+    {"sp_mul", COV_MUL_BINS},
+    {"dp_mul", COV_MUL_BINS},
+    {"sp_div", COV_DIV_BINS},
+    {"dp_div", COV_DIV_BINS},
+    {"sp_fma", COV_FMA_BINS},
+    {"dp_fma", COV_FMA_BINS},
+    {"sp_sqrt", COV_SQRT_BINS},
+    {"dp_sqrt", COV_SQRT_BINS},
+    {"hp_add", COV_ADDER_BINS},
+    {"hp_mul", COV_MUL_BINS},
+    {"hp_fma", COV_FMA_BINS},
+    {"hp_cvt", {"nan", "inf", "zero", "denorm_in", "tiny_check", "denorm_out", "rne_up", "rdn_up", "rup_up",
+                "rmm_up", "round_carry", "overflow_inf", "overflow_max", "underflow"}},
+};
+
+#undef COV_ADDER_BINS
+#undef COV_MUL_BINS
+#undef COV_DIV_BINS
+#undef COV_FMA_BINS
+#undef COV_SQRT_BINS
+#undef COV_CMP_BINS
+
+// unit whose bins an op reports, as FPU_Top's unit_sel picks it; -1 for ops without bins
+inline int cov_unit(uint8_t func7) {
+    switch (func7) {
+        case OP_FADD_S: case OP_FSUB_S: case OP_FADD_PS: case OP_FSUB_PS: return 0;
+        case OP_FADD_D: case OP_FSUB_D:                                   return 1;
+        case OP_FCMP_S: case OP_FCMP_PS:                                  return 2;
+        case OP_FCMP_D:                                                   return 3;
+        case OP_FCVT_D_S: case OP_FCVT_W_S: case OP_FCVT_D_W: case OP_FCVT_W_PS: return 4;
+        case OP_FCVT_S_D: case OP_FCVT_W_D: case OP_FCVT_S_W: case OP_FCVT_PS_W: return 5;
+        case OP_FMUL_S: case OP_FMUL_PS:                                  return 6;
+        case OP_FMUL_D:                                                   return 7;
+        case OP_FDIV_S: case OP_FDIV_PS:                                  return 8;
+        case OP_FDIV_D:                                                   return 9;
+        case OP_FMADD_S: case OP_FMSUB_S: case OP_FNMSUB_S: case OP_FNMADD_S: return 10;
+        case OP_FMADD_D: case OP_FMSUB_D: case OP_FNMSUB_D: case OP_FNMADD_D: return 11;
+        case OP_FSQRT_S:                                                  return 12;
+        case OP_FSQRT_D:                                                  return 13;
+        case OP_FADD_H4: case OP_FSUB_H4: case OP_FADD_B4: case OP_FSUB_B4: return 14;
+        case OP_FMUL_H4: case OP_FMUL_B4:                                 return 15;
+        case OP_FMADD_H4: case OP_FMSUB_H4: case OP_FNMSUB_H4: case OP_FNMADD_H4:
+        case OP_FMADD_B4: case OP_FMSUB_B4: case OP_FNMSUB_B4: case OP_FNMADD_B4: return 16;
+        case OP_FCVT_H4_S: case OP_FCVT_H4_D: case OP_FCVT_PS_H4: case OP_FCVT_D_H4:
+        case OP_FCVT_B4_S: case OP_FCVT_B4_D: case OP_FCVT_PS_B4: case OP_FCVT_D_B4: return 17;
+        default:                                                          return -1;
+    }
+}
+
+// --- Hit Counts ---
+struct Coverage {
+    std::vector<std::vector<uint64_t>> hits;    // [unit][bin]
+
+    Coverage() {
+        for (const CovUnit& u : cov_units) hits.emplace_back(u.bins.size(), 0);
+    }
+
+    // count the bins one written-back op reported; true when one of them was never hit before
+    bool add(uint8_t func7, uint32_t bits) {
+        int u = cov_unit(func7);
+        if (u < 0) return false;
+        bool fresh = false;
+        for (size_t b = 0; b < hits[u].size(); b++) {
+            if (!((bits >> b) & 1)) continue;
+            fresh |= hits[u][b] == 0;
+            hits[u][b]++;
+        }
+        return fresh;
+    }
+
+    size_t reached(int u) const {
+        size_t n = 0;
+        for (uint64_t h : hits[u]) n += h != 0;
+        return n;
+    }
+    size_t reached() const {
+        size_t n = 0;
+        for (size_t u = 0; u < hits.size(); u++) n += reached(u);
+        return n;
+    }
+    size_t bins() const {
+        size_t n = 0;
+        for (const std::vector<uint64_t>& h : hits) n += h.size();
+        return n;
+    }
+
+    void merge(const Coverage& other) {
+        for (size_t u = 0; u < hits.size(); u++) {
+            for (size_t b = 0; b < hits[u].size(); b++) hits[u][b] += other.hits[u][b];
+        }
+    }
+
+    // one "unit bin hits" line per bin, also the unreached ones
+    bool write(const std::string& path) const {
+        std::ofstream out(path);
+        for (size_t u = 0; u < hits.size(); u++) {
+            for (size_t b = 0; b < hits[u].size(); b++) out << cov_units[u].name << " " << cov_units[u].bins[b] << " " << hits[u][b] << "\n";
+        }
+        return (bool)out;
+    }
+
+    // add the counts of a file written by write(), so runs of different drivers can be combined
+    bool read(const std::string& path) {
+        std::ifstream in(path);
+        if (!in) return false;
+        std::string unit, bin;
+        uint64_t count;
+        while (in >> unit >> bin >> count) {
+            for (size_t u = 0; u < hits.size(); u++) {
+                if (unit != cov_units[u].name) continue;
+                for (size_t b = 0; b < hits[u].size(); b++) {
+                    if (bin == cov_units[u].bins[b]) hits[u][b] += count;
+                }
+            }
+        }
+        return true;
+    }
+
+    // reached / total per unit and the bins no op reached
+    void report(std::ostream& out) const {
+        for (size_t u = 0; u < hits.size(); u++) {
+            out << "  " << std::left << std::setw(9) << cov_units[u].name << std::right << std::setw(3) << reached(u) << " / "
+                << std::setw(2) << hits[u].size();
+            const char* sep = "  unreached: ";
+            for (size_t b = 0; b < hits[u].size(); b++) {
+                if (hits[u][b]) continue;
+                out << sep << cov_units[u].bins[b];
+                sep = ", ";
+            }
+            out << "\n";
+        }
+    }
+};
+
+// --- Coverage-Guided Stimulus ---
+// Op source for the fuzzer and the benchmark. Each op is drawn from the mix with its weight
+// scaled by 1 + the number of bins its unit has not reached yet. With probability mutate_p the
+// operands are not fresh from gen_operand but a mutation of a corpus entry: every op that
+// reaches a new bin, or one hit fewer than RARE_HITS times, is kept in the corpus.
+struct CovSeed {
+    size_t   op;                // op_table index
+    uint8_t  func3;
+    uint8_t  rs2;
+    uint64_t a, b, c;
+    bool     ftz = false;
+};
+
+class CovGuide {
+public:
+    static const uint64_t RARE_HITS = 8;
+    static const size_t CORPUS_MAX = 4096;
+
+    Coverage coverage;
+    uint64_t observed = 0;
+    uint64_t last_new = 0;      // ops observed when the last new bin was reached
+
+    CovGuide(const std::vector<double>& weights, const std::vector<uint8_t>& rounding_modes, double mutate_p, double ftz_p)
+        : weights(weights), rounding_modes(rounding_modes), mutate_p(mutate_p), ftz_p(ftz_p) {
+        reweigh();
+    }
+
+    CovSeed next(std::mt19937_64& rng) {
+        if (!corpus.empty() && std::generate_canonical<double, 53>(rng) < mutate_p) {
+            CovSeed s = corpus[rng() % corpus.size()];
+            const OpInfo& op = op_table[s.op];
+            if (rng() % 4 == 0) {
+                pick_modes(rng, s);
+            } else {
+                uint64_t* operands[3] = {&s.a, &s.b, &s.c};
+                uint64_t& x = *operands[rng() % op.operands];
+                x = mutate(rng, op.format, x);
+            }
+            return s;
+        }
+        CovSeed s;
+        s.op = pick(rng);
+        const OpInfo& op = op_table[s.op];
+        pick_modes(rng, s);
+        s.a = gen_operand(rng, op.format);
+        s.b = gen_operand(rng, op.format);
+        s.c = gen_operand(rng, op.format);
+        s.ftz = std::generate_canonical<double, 53>(rng) < ftz_p;
+        return s;
+    }
+
+    // the cov_out an issued seed came back with
+    void observe(const CovSeed& s, uint32_t bits) {
+        observed++;
+        uint8_t func7 = op_table[s.op].func7;
+        if (coverage.add(func7, bits)) {
+            last_new = observed;
+            reweigh();
+        }
+        int u = cov_unit(func7);
+        bool rare = false;
+        for (size_t b = 0; u >= 0 && b < coverage.hits[u].size(); b++) {
+            if (((bits >> b) & 1) && coverage.hits[u][b] <= RARE_HITS) rare = true;
+        }
+        if (!rare) return;
+        if (corpus.size() < CORPUS_MAX) corpus.push_back(s);
+        else corpus[observed % CORPUS_MAX] = s;
+    }
+
+private:
+    std::vector<double> weights;
+    std::vector<uint8_t> rounding_modes;
+    double mutate_p, ftz_p;
+    std::discrete_distribution<size_t> pick;
+    std::vector<CovSeed> corpus;
+
+    void reweigh() {
+        std::vector<double> w = weights;
+        for (size_t i = 0; i < w.size(); i++) {
+            int u = cov_unit(op_table[i].func7);
+            if (u >= 0) w[i] *= 1 + cov_units[u].bins.size() - coverage.reached(u);
+        }
+        pick = std::discrete_distribution<size_t>(w.begin(), w.end());
+    }
+
+    void pick_modes(std::mt19937_64& rng, CovSeed& s) {
+        static const uint8_t compares[] = {CMP_LE, CMP_LT, CMP_EQ};
+        const OpInfo& op = op_table[s.op];
+        s.func3 = op.compare ? compares[rng() % 3] : rounding_modes[rng() % rounding_modes.size()];
+        s.rs2 = op.max_rs2 ? rng() % (op.max_rs2 + 1) : 0;
+    }
+
+    // change one lane of an operand: a bit, a small step (ties, carry chains), the exponent,
+    // the sign, or a fresh value
+    static uint64_t mutate(std::mt19937_64& rng, OperandFormat format, uint64_t x) {
+        int width = 32, man_w = 0, shift = 0;
+        switch (format) {
+            case F32:   man_w = 23; break;
+            case F64:   width = 64; man_w = 52; break;
+            case PS:    man_w = 23; shift = 32 * (rng() % 2); break;
+            case H4:    width = 16; man_w = 10; shift = 16 * (rng() % 4); break;
+            case B4:    width = 16; man_w = 7; shift = 16 * (rng() % 4); break;
+            case I32:   break;
+            case I32X2: shift = 32 * (rng() % 2); break;
+        }
+        uint64_t mask = width == 64 ? ~0ull : (1ull << width) - 1;
+        uint64_t lane = (x >> shift) & mask;
+        switch (rng() % (man_w ? 5 : 3)) {
+            case 0: lane ^= 1ull << (rng() % width); break;
+            case 1: lane += rng() % 7 - 3; break;
+            case 2: lane = gen_operand(rng, format) >> shift; break;
+            case 3: lane ^= 1ull << (width - 1); break;
+            case 4: lane += (rng() % 2 ? 1ull : -1ull) << man_w; break;
+        }
+        return (x & ~(mask << shift)) | ((lane & mask) << shift);
+    }
+};
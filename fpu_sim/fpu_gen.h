@@ -0,0 +1,93 @@
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <random>
+
+#include "fpu_opcodes.h"
+#include "fpu_ref.h"
+
+// Random operands for the fuzzer, the unit-level harness and the benchmark. The default is
+// biased toward special values, the denormal / overflow boundaries and mantissas that sit on
+// rounding ties or carry chains; the benchmark also draws plain bit patterns, normals or
+// denormal-heavy operands.
+enum Distribution {
+    DIST_EDGE,                  // edge-biased, as above
+    DIST_RANDOM,                // uniform bit patterns, so all classes incl. NaN / Inf
+    DIST_NORMAL,                // finite normals with exponents near the bias
+    DIST_DENORMAL               // half of the values denormal, the rest uniform
+};
+
+inline uint64_t gen_float(std::mt19937_64& rng, fpu_ref::Format f, Distribution dist = DIST_EDGE) {
+    using namespace fpu_ref;
+    uint64_t bits = rng();
+    uint64_t man = bits & man_mask(f);
+    uint64_t e = (bits >> f.man_w) & exp_max(f);
+    bool sign = bits >> 63;
+
+    switch (dist) {
+        case DIST_EDGE:
+            break;
+        case DIST_RANDOM:
+            return pack(f, sign, e, man);
+        case DIST_NORMAL:
+            // bias +- 16, at least 1 for the narrow formats
+            e = std::max<int64_t>(1, bias(f) + (int64_t)((bits >> 56) & 0x1F) - 16);
+            return pack(f, sign, e, man);
+        case DIST_DENORMAL:
+            if ((bits >> 62) & 1) {
+                e = 0;
+                if (man == 0) man = 1;
+            }
+            return pack(f, sign, e, man);
+    }
+
+    switch (rng() % 4) {
+        case 0: man = man_mask(f); break;                                   // all ones
+        case 1: man &= man_mask(f) << (f.man_w - 1 - rng() % 4); break;     // few top bits
+        case 2: man = 1ull << (rng() % f.man_w); break;                     // single bit
+        default: break;
+    }
+    switch (rng() % 16) {
+        case 0:          e = 0; man = 0; break;                             // zero
+        case 1:          e = exp_max(f); man = 0; break;                    // infinity
+        case 2:          e = exp_max(f); if (man == 0) man = 1; break;      // NaN
+        case 3: case 4:  e = 0; break;                                      // denormal
+        case 5: case 6:  e = 1 + rng() % 4; break;                          // near underflow
+        case 7: case 8:  e = exp_max(f) - 1 - rng() % 4; break;             // near overflow
+        case 9: case 10: case 11: e = bias(f) - 2 + rng() % 5; break;       // near 1.0
+        default: break;                                                     // uniform
+    }
+    if (e == exp_max(f) && man != 0 && rng() % 2) man |= 1ull << (f.man_w - 1);  // mostly quiet
+    return pack(f, sign, e, man);
+}
+
+// integers are edge-biased under DIST_EDGE and uniform otherwise
+inline uint32_t gen_int(std::mt19937_64& rng, Distribution dist = DIST_EDGE) {
+    static const uint32_t edges[] = {0, 1, 0xFFFFFFFF, 0x7FFFFFFF, 0x80000000, 0x00FFFFFF, 0x01000001, 0xFF000001};
+    if (dist != DIST_EDGE) return (uint32_t)rng();
+    switch (rng() % 4) {
+        case 0:  return (uint32_t)(int32_t)(rng() % 2001 - 1000);
+        case 1:  return (1u << (rng() % 32)) + (uint32_t)(rng() % 3) - 1;
+        case 2:  return edges[rng() % (sizeof(edges) / sizeof(edges[0]))];
+        default: return (uint32_t)rng();
+    }
+}
+
+inline uint64_t gen_operand(std::mt19937_64& rng, OperandFormat format, Distribution dist = DIST_EDGE) {
+    switch (format) {
+        case F32:   return gen_float(rng, fpu_ref::FMT_S, dist);
+        case F64:   return gen_float(rng, fpu_ref::FMT_D, dist);
+        case PS:    return (gen_float(rng, fpu_ref::FMT_S, dist) << 32) | gen_float(rng, fpu_ref::FMT_S, dist);
+        case I32:   return gen_int(rng, dist);
+        case I32X2: return ((uint64_t)gen_int(rng, dist) << 32) | gen_int(rng, dist);
+        case H4:
+        case B4: {
+            uint64_t v = 0;
+            for (int l = 0; l < 4; l++) {
+                v |= gen_float(rng, format == H4 ? fpu_ref::FMT_H : fpu_ref::FMT_B, dist) << (16 * l);
+            }
+            return v;
+        }
+    }
+    return 0;
+}
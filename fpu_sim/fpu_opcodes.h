@@ -0,0 +1,153 @@
+#pragma once
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// --- Opcode Definitions (Must match FPU_Top.v) ---
+// func7
+const uint8_t OP_FADD_S  = 0b0000000, OP_FADD_D  = 0b0000001;
+const uint8_t OP_FSUB_S  = 0b0000100, OP_FSUB_D  = 0b0000101;
+const uint8_t OP_FMUL_S  = 0b0001000, OP_FMUL_D  = 0b0001001;
+const uint8_t OP_FDIV_S  = 0b0001100, OP_FDIV_D  = 0b0001101;
+const uint8_t OP_FMADD_S  = 0b0010000, OP_FMADD_D  = 0b0010001;
+const uint8_t OP_FMSUB_S  = 0b0010100, OP_FMSUB_D  = 0b0010101;
+const uint8_t OP_FNMSUB_S = 0b0011000, OP_FNMSUB_D = 0b0011001;
+const uint8_t OP_FNMADD_S = 0b0011100, OP_FNMADD_D = 0b0011101;
+const uint8_t OP_FSQRT_S = 0b0101100, OP_FSQRT_D = 0b0101101;
+const uint8_t OP_FCMP_S  = 0b1010000, OP_FCMP_D  = 0b1010001;
+
+const uint8_t OP_FCVT_D_S  = 0b0100001;
+const uint8_t OP_FCVT_W_S  = 0b1100000;
+const uint8_t OP_FCVT_D_W  = 0b1101001;
+
+const uint8_t OP_FCVT_S_D  = 0b0100000;
+const uint8_t OP_FCVT_W_D  = 0b1100001;
+const uint8_t OP_FCVT_S_W  = 0b1101000;
+
+const uint8_t OP_FADD_PS   = 0b0000011, OP_FSUB_PS = 0b0000111;
+const uint8_t OP_FMUL_PS   = 0b0001011, OP_FDIV_PS = 0b0001111;
+const uint8_t OP_FCMP_PS   = 0b1010011;
+const uint8_t OP_FCVT_W_PS = 0b1100011, OP_FCVT_PS_W = 0b1101011;
+
+const uint8_t OP_FADD_H4   = 0b0000010, OP_FADD_B4   = 0b1000010;
+const uint8_t OP_FSUB_H4   = 0b0000110, OP_FSUB_B4   = 0b1000110;
+const uint8_t OP_FMUL_H4   = 0b0001010, OP_FMUL_B4   = 0b1001010;
+const uint8_t OP_FMADD_H4  = 0b0010010, OP_FMADD_B4  = 0b1010010;
+const uint8_t OP_FMSUB_H4  = 0b0010110, OP_FMSUB_B4  = 0b1010110;
+const uint8_t OP_FNMSUB_H4 = 0b0011010, OP_FNMSUB_B4 = 0b1011010;
+const uint8_t OP_FNMADD_H4 = 0b0011110, OP_FNMADD_B4 = 0b1011110;
+const uint8_t OP_FCVT_H4_S  = 0b0100010, OP_FCVT_B4_S  = 0b0110010;
+const uint8_t OP_FCVT_H4_D  = 0b0100110, OP_FCVT_B4_D  = 0b0110110;
+const uint8_t OP_FCVT_PS_H4 = 0b0100011, OP_FCVT_PS_B4 = 0b0110011;
+const uint8_t OP_FCVT_D_H4  = 0b0100111, OP_FCVT_D_B4  = 0b0110111;
+
+// func3
+const uint8_t CMP_EQ = 0b010;
+const uint8_t CMP_LT = 0b001;
+const uint8_t CMP_LE = 0b000;
+
+const uint8_t RNE = 0b000;
+const uint8_t RTZ = 0b001;
+const uint8_t RDN = 0b010;
+const uint8_t RUP = 0b011;
+const uint8_t RMM = 0b100;
+
+// rs2
+const uint8_t CVT_NN = 0b00000;
+const uint8_t CVT_W  = 0b00000;
+const uint8_t CVT_WU = 0b00001;
+
+// --- Performance Counters (Must match the counter block in FPU_Top.v) ---
+const int NUM_PERF_COUNTERS = 33;
+const char* const perf_counter_names[NUM_PERF_COUNTERS] = {
+    "issued_sp_add", "issued_dp_add", "issued_sp_cmp", "issued_dp_cmp", "issued_sp_cvt", "issued_dp_cvt",
+    "issued_sp_mul", "issued_dp_mul", "issued_sp_div", "issued_dp_div", "issued_sp_fma", "issued_dp_fma",
+    "issued_sp_sqrt", "issued_dp_sqrt", "issued_hp_add", "issued_hp_mul", "issued_hp_fma", "issued_hp_cvt",
+    "issued_illegal", "stall_cycles",
+    "busy_sp_div", "busy_dp_div", "busy_sp_sqrt", "busy_dp_sqrt", "div_wait_cycles",
+    "flag_nv", "flag_dz", "flag_of", "flag_uf", "flag_nx",
+    "denormal_operand_ops", "nan_operand_ops", "cycles"
+};
+
+// read every counter through the perf_addr / perf_rdata port
+template <typename Model>
+std::vector<uint64_t> read_perf_counters(Model* top) {
+    std::vector<uint64_t> counters;
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        top->perf_addr = i;
+        top->eval();
+        counters.push_back(top->perf_rdata);
+    }
+    return counters;
+}
+
+// --- Operation Table (shared by the benchmark and fuzz drivers) ---
+// Operand formats as seen on operand_a / operand_b / operand_c
+enum OperandFormat {
+    F32, F64, PS, H4, B4, I32, I32X2
+};
+
+struct OpInfo {
+    const char* name;           // mnemonic, also the OP_* constant in upper case
+    uint8_t func7;
+    OperandFormat format;
+    int operands;               // 1: a, 2: a, b, 3: a, b, c
+    bool compare;               // func3 is a compare type instead of a rounding mode
+    int max_rs2;                // rs2 drawn from 0..max_rs2 (int signedness, lane select)
+};
+
+const std::vector<OpInfo> op_table = {
+    {"fadd.s",     OP_FADD_S,     F32,   2, false, 0}, {"fadd.d",     OP_FADD_D,     F64,   2, false, 0},
+    {"fsub.s",     OP_FSUB_S,     F32,   2, false, 0}, {"fsub.d",     OP_FSUB_D,     F64,   2, false, 0},
+    {"fmul.s",     OP_FMUL_S,     F32,   2, false, 0}, {"fmul.d",     OP_FMUL_D,     F64,   2, false, 0},
+    {"fdiv.s",     OP_FDIV_S,     F32,   2, false, 0}, {"fdiv.d",     OP_FDIV_D,     F64,   2, false, 0},
+    {"fsqrt.s",    OP_FSQRT_S,    F32,   1, false, 0}, {"fsqrt.d",    OP_FSQRT_D,    F64,   1, false, 0},
+    {"fmadd.s",    OP_FMADD_S,    F32,   3, false, 0}, {"fmadd.d",    OP_FMADD_D,    F64,   3, false, 0},
+    {"fmsub.s",    OP_FMSUB_S,    F32,   3, false, 0}, {"fmsub.d",    OP_FMSUB_D,    F64,   3, false, 0},
+    {"fnmsub.s",   OP_FNMSUB_S,   F32,   3, false, 0}, {"fnmsub.d",   OP_FNMSUB_D,   F64,   3, false, 0},
+    {"fnmadd.s",   OP_FNMADD_S,   F32,   3, false, 0}, {"fnmadd.d",   OP_FNMADD_D,   F64,   3, false, 0},
+    {"fcmp.s",     OP_FCMP_S,     F32,   2, true,  0}, {"fcmp.d",     OP_FCMP_D,     F64,   2, true,  0},
+    {"fcvt.d.s",   OP_FCVT_D_S,   F32,   1, false, 0}, {"fcvt.s.d",   OP_FCVT_S_D,   F64,   1, false, 0},
+    {"fcvt.w.s",   OP_FCVT_W_S,   F32,   1, false, 1}, {"fcvt.w.d",   OP_FCVT_W_D,   F64,   1, false, 1},
+    {"fcvt.s.w",   OP_FCVT_S_W,   I32,   1, false, 1}, {"fcvt.d.w",   OP_FCVT_D_W,   I32,   1, false, 1},
+    {"fadd.ps",    OP_FADD_PS,    PS,    2, false, 0}, {"fsub.ps",    OP_FSUB_PS,    PS,    2, false, 0},
+    {"fmul.ps",    OP_FMUL_PS,    PS,    2, false, 0}, {"fdiv.ps",    OP_FDIV_PS,    PS,    2, false, 0},
+    {"fcmp.ps",    OP_FCMP_PS,    PS,    2, true,  0},
+    {"fcvt.w.ps",  OP_FCVT_W_PS,  PS,    1, false, 1}, {"fcvt.ps.w",  OP_FCVT_PS_W,  I32X2, 1, false, 1},
+    {"fadd.h4",    OP_FADD_H4,    H4,    2, false, 0}, {"fadd.b4",    OP_FADD_B4,    B4,    2, false, 0},
+    {"fsub.h4",    OP_FSUB_H4,    H4,    2, false, 0}, {"fsub.b4",    OP_FSUB_B4,    B4,    2, false, 0},
+    {"fmul.h4",    OP_FMUL_H4,    H4,    2, false, 0}, {"fmul.b4",    OP_FMUL_B4,    B4,    2, false, 0},
+    {"fmadd.h4",   OP_FMADD_H4,   H4,    3, false, 0}, {"fmadd.b4",   OP_FMADD_B4,   B4,    3, false, 0},
+    {"fmsub.h4",   OP_FMSUB_H4,   H4,    3, false, 0}, {"fmsub.b4",   OP_FMSUB_B4,   B4,    3, false, 0},
+    {"fnmsub.h4",  OP_FNMSUB_H4,  H4,    3, false, 0}, {"fnmsub.b4",  OP_FNMSUB_B4,  B4,    3, false, 0},
+    {"fnmadd.h4",  OP_FNMADD_H4,  H4,    3, false, 0}, {"fnmadd.b4",  OP_FNMADD_B4,  B4,    3, false, 0},
+    {"fcvt.h4.s",  OP_FCVT_H4_S,  PS,    2, false, 0}, {"fcvt.b4.s",  OP_FCVT_B4_S,  PS,    2, false, 0},
+    {"fcvt.h4.d",  OP_FCVT_H4_D,  F64,   1, false, 0}, {"fcvt.b4.d",  OP_FCVT_B4_D,  F64,   1, false, 0},
+    {"fcvt.ps.h4", OP_FCVT_PS_H4, H4,    1, false, 1}, {"fcvt.ps.b4", OP_FCVT_PS_B4, B4,    1, false, 1},
+    {"fcvt.d.h4",  OP_FCVT_D_H4,  H4,    1, false, 3}, {"fcvt.d.b4",  OP_FCVT_D_B4,  B4,    1, false, 3},
+};
+
+// "fadd.s:4,fdiv.d:1" -> weights per op_table entry; "all" weighs every op equally
+inline bool parse_op_mix(const std::string& mix, std::vector<double>& weights) {
+    weights.assign(op_table.size(), mix == "all" ? 1.0 : 0.0);
+    if (mix == "all") return true;
+    std::stringstream ss(mix);
+    std::string item;
+    while (std::getline(ss, item, ',')) {
+        size_t colon = item.find(':');
+        std::string name = item.substr(0, colon);
+        double weight = (colon == std::string::npos) ? 1.0 : std::atof(item.c_str() + colon + 1);
+        bool found = false;
+        for (size_t i = 0; i < op_table.size(); i++) {
+            if (name == op_table[i].name) { weights[i] = weight; found = true; }
+        }
+        if (!found) {
+            std::cerr << "Unknown op in mix: " << name << std::endl;
+            return false;
+        }
+    }
+    return true;
+}
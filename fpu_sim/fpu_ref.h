@@ -0,0 +1,561 @@
+#pragma once
+#include <cstdint>
+#include <algorithm>
+
+#include "fpu_opcodes.h"
+
+// Bit-accurate reference model of every FPU_Top opcode, all five rounding modes and the five
+// flags. Values are unpacked to integer significands and rounded once in integer arithmetic,
+// so the host FPU (and its rounding state) is never used.
+//
+// Semantics are IEEE 754 binary16 / bfloat16 / binary32 / binary64 with the conventions the
+// directed tests in tb_fpu.cpp pin down:
+//   - NaN results are the positive canonical quiet NaN of the result format.
+//   - Arithmetic and float -> float conversions raise NV for any NaN operand; FCMP raises NV
+//     only for a signaling NaN and returns 0 for every predicate on unordered operands.
+//   - Tininess is detected after rounding; UF is raised only for tiny inexact results.
+//   - Float -> int: NaN gives INT32_MIN / UINT32_MAX with NV. Out-of-range values saturate
+//     with NV and OF (plus NX when finite); negative values that round to a non-zero integer
+//     give 0 with NV for the unsigned conversion. Integer results are zero-extended.
+//   - Scalar FP32 and 32-bit integer results are zero-extended to 64 bits.
+//   - Unknown opcodes return 0x7FF8000000000000 with NV.
+//   - ftz mode: denormal FP inputs read as a zero of the same sign (no flag); a tiny FP result
+//     lane (tininess after rounding, as above) becomes a zero of the same sign and raises UF
+//     and NX, including one that IEEE rounding takes up to the smallest normal.
+namespace fpu_ref {
+
+typedef unsigned __int128 u128;
+
+// flags, packed as on flag_lanes: {NV, DZ, OF, UF, NX}
+const uint8_t FLAG_NV = 0x10, FLAG_DZ = 0x08, FLAG_OF = 0x04, FLAG_UF = 0x02, FLAG_NX = 0x01;
+
+struct Format {
+    int exp_w;
+    int man_w;
+};
+const Format FMT_H = {5, 10}, FMT_B = {8, 7}, FMT_S = {8, 23}, FMT_D = {11, 52};
+
+struct RefResult {
+    uint64_t result;
+    uint8_t  flags;             // OR of all lanes
+    uint32_t flag_lanes;        // lane n in [5n+4:5n], scalar ops use lane 0
+};
+
+// --- Unpacking ---
+enum Class {
+    CLS_ZERO, CLS_FINITE, CLS_INF, CLS_QNAN, CLS_SNAN
+};
+
+struct Unpacked {
+    Class    cls;
+    bool     sign;
+    int      exp;               // value = sig * 2^exp for CLS_FINITE
+    uint64_t sig;
+};
+
+inline int bias(Format f) { return (1 << (f.exp_w - 1)) - 1; }
+inline uint64_t exp_max(Format f) { return (1ull << f.exp_w) - 1; }
+inline uint64_t man_mask(Format f) { return (1ull << f.man_w) - 1; }
+
+inline Unpacked unpack(Format f, uint64_t bits) {
+    Unpacked u;
+    uint64_t man = bits & man_mask(f);
+    uint64_t e = (bits >> f.man_w) & exp_max(f);
+    u.sign = (bits >> (f.exp_w + f.man_w)) & 1;
+    u.exp = 0;
+    u.sig = 0;
+    if (e == exp_max(f)) {
+        u.cls = (man == 0) ? CLS_INF : ((man >> (f.man_w - 1)) & 1) ? CLS_QNAN : CLS_SNAN;
+    } else if (e == 0 && man == 0) {
+        u.cls = CLS_ZERO;
+    } else {
+        u.cls = CLS_FINITE;
+        u.sig = e ? (man | (1ull << f.man_w)) : man;
+        u.exp = (e ? (int)e : 1) - bias(f) - f.man_w;
+    }
+    return u;
+}
+
+inline bool is_nan(const Unpacked& u) { return u.cls == CLS_QNAN || u.cls == CLS_SNAN; }
+
+inline uint64_t pack(Format f, bool sign, uint64_t e, uint64_t man) {
+    return ((uint64_t)sign << (f.exp_w + f.man_w)) | (e << f.man_w) | man;
+}
+inline uint64_t canonical_nan(Format f) { return pack(f, 0, exp_max(f), 1ull << (f.man_w - 1)); }
+inline uint64_t infinity(Format f, bool sign) { return pack(f, sign, exp_max(f), 0); }
+inline uint64_t zero(Format f, bool sign) { return pack(f, sign, 0, 0); }
+
+// --- Integer Helpers ---
+inline int bit_length(u128 x) {
+    uint64_t hi = (uint64_t)(x >> 64), lo = (uint64_t)x;
+    if (hi) return 128 - __builtin_clzll(hi);
+    if (lo) return 64 - __builtin_clzll(lo);
+    return 0;
+}
+
+// x >> n with the shifted-out bits ORed into bit 0
+inline u128 shift_right_jam(u128 x, int n) {
+    if (n <= 0) return x;
+    if (n >= 128) return x != 0;
+    return (x >> n) | ((x & (((u128)1 << n) - 1)) != 0);
+}
+
+// x >> n split into the kept part, the guard bit and the sticky OR below it
+inline void shift_round(u128 x, int n, u128& kept, bool& g, bool& st) {
+    if (n <= 0) {
+        kept = x << -n;
+        g = false; st = false;
+    } else if (n >= 128) {
+        kept = 0;
+        g = false; st = x != 0;  // callers keep x below 2^126
+    } else {
+        kept = x >> n;
+        g = (x >> (n - 1)) & 1;
+        st = (x & (((u128)1 << (n - 1)) - 1)) != 0;
+    }
+}
+
+inline bool round_increment(int rm, bool sign, bool lsb, bool g, bool st) {
+    switch (rm) {
+        case RNE: return g && (st || lsb);
+        case RTZ: return false;
+        case RDN: return sign && (g || st);
+        case RUP: return !sign && (g || st);
+        case RMM: return g;
+        default:  return false;
+    }
+}
+
+inline bool overflow_to_inf(int rm, bool sign) {
+    return rm == RNE || rm == RMM || (rm == RUP && !sign) || (rm == RDN && sign);
+}
+
+// --- Rounding ---
+// Round (-1)^sign * sig * 2^exp (sig != 0, below 2^126) to format f.
+inline uint64_t round_pack(Format f, bool sign, int exp, u128 sig, int rm, uint8_t& flags) {
+    int e_msb = exp + bit_length(sig) - 1;
+    int emin = 1 - bias(f);
+    int lsb_exp = std::max(e_msb - f.man_w, emin - f.man_w);
+
+    u128 kept;
+    bool g, st;
+    shift_round(sig, lsb_exp - exp, kept, g, st);
+    bool inexact = g || st;
+    if (round_increment(rm, sign, kept & 1, g, st)) kept++;
+    if (kept >> (f.man_w + 1)) {
+        kept >>= 1;
+        lsb_exp++;
+    }
+
+    // tiny when the result rounded with an unbounded exponent is still below 2^emin
+    bool tiny = false;
+    if (e_msb < emin) {
+        tiny = true;
+        if (e_msb == emin - 1) {
+            u128 k2;
+            bool g2, st2;
+            shift_round(sig, e_msb - f.man_w - exp, k2, g2, st2);
+            if (round_increment(rm, sign, k2 & 1, g2, st2)) k2++;
+            if (k2 >> (f.man_w + 1)) tiny = false;
+        }
+    }
+    if (inexact) flags |= FLAG_NX;
+    if (tiny && inexact) flags |= FLAG_UF;
+
+    uint64_t biased = (kept >> f.man_w) ? (uint64_t)(lsb_exp + f.man_w + bias(f)) : 0;
+    if (biased >= exp_max(f)) {
+        flags |= FLAG_OF | FLAG_NX;
+        return overflow_to_inf(rm, sign) ? infinity(f, sign) : pack(f, sign, exp_max(f) - 1, man_mask(f));
+    }
+    return pack(f, sign, biased, (uint64_t)kept & man_mask(f));
+}
+
+// exact repack of a finite unpacked value (no flags can be raised)
+inline uint64_t repack(Format f, const Unpacked& u) {
+    uint8_t unused = 0;
+    return round_pack(f, u.sign, u.exp, u.sig, RNE, unused);
+}
+
+// (-1)^sa * siga * 2^ea + (-1)^sb * sigb * 2^eb, both non-zero and below 2^110, rounded once
+inline uint64_t add_finite(Format f, bool sa, int ea, u128 siga, bool sb, int eb, u128 sigb, int rm, uint8_t& flags) {
+    if (ea + bit_length(siga) < eb + bit_length(sigb)) {
+        std::swap(sa, sb); std::swap(ea, eb); std::swap(siga, sigb);
+    }
+    // larger operand's MSB to bit 124, the other aligned below it with a sticky bit
+    int la = 125 - bit_length(siga);
+    u128 a = siga << la;
+    int e = ea - la;
+    int d = eb - e;
+    u128 b = (d >= 0) ? (sigb << d) : shift_right_jam(sigb, -d);
+
+    u128 sum;
+    bool sign;
+    if (sa == sb) {
+        sum = a + b; sign = sa;
+    } else if (a >= b) {
+        sum = a - b; sign = sa;
+    } else {
+        sum = b - a; sign = sb;
+    }
+    if (sum == 0) return zero(f, rm == RDN);
+    return round_pack(f, sign, e, sum, rm, flags);
+}
+
+// --- Arithmetic ---
+inline uint64_t add(Format f, uint64_t a, uint64_t b, bool subtract, int rm, uint8_t& flags) {
+    Unpacked x = unpack(f, a), y = unpack(f, b);
+    if (is_nan(x) || is_nan(y)) { flags |= FLAG_NV; return canonical_nan(f); }
+    y.sign ^= subtract;
+    if (x.cls == CLS_INF) {
+        if (y.cls == CLS_INF && x.sign != y.sign) { flags |= FLAG_NV; return canonical_nan(f); }
+        return infinity(f, x.sign);
+    }
+    if (y.cls == CLS_INF) return infinity(f, y.sign);
+    if (x.cls == CLS_ZERO && y.cls == CLS_ZERO) {
+        return zero(f, (x.sign == y.sign) ? x.sign : rm == RDN);
+    }
+    if (x.cls == CLS_ZERO) return repack(f, y);
+    if (y.cls == CLS_ZERO) return repack(f, x);
+    return add_finite(f, x.sign, x.exp, x.sig, y.sign, y.exp, y.sig, rm, flags);
+}
+
+inline uint64_t mul(Format f, uint64_t a, uint64_t b, int rm, uint8_t& flags) {
+    Unpacked x = unpack(f, a), y = unpack(f, b);
+    bool sign = x.sign ^ y.sign;
+    if (is_nan(x) || is_nan(y)) { flags |= FLAG_NV; return canonical_nan(f); }
+    if ((x.cls == CLS_INF && y.cls == CLS_ZERO) || (x.cls == CLS_ZERO && y.cls == CLS_INF)) {
+        flags |= FLAG_NV; return canonical_nan(f);
+    }
+    if (x.cls == CLS_INF || y.cls == CLS_INF) return infinity(f, sign);
+    if (x.cls == CLS_ZERO || y.cls == CLS_ZERO) return zero(f, sign);
+    return round_pack(f, sign, x.exp + y.exp, (u128)x.sig * y.sig, rm, flags);
+}
+
+inline uint64_t div(Format f, uint64_t a, uint64_t b, int rm, uint8_t& flags) {
+    Unpacked x = unpack(f, a), y = unpack(f, b);
+    bool sign = x.sign ^ y.sign;
+    if (is_nan(x) || is_nan(y)) { flags |= FLAG_NV; return canonical_nan(f); }
+    if ((x.cls == CLS_INF && y.cls == CLS_INF) || (x.cls == CLS_ZERO && y.cls == CLS_ZERO)) {
+        flags |= FLAG_NV; return canonical_nan(f);
+    }
+    if (x.cls == CLS_INF) return infinity(f, sign);
+    if (y.cls == CLS_INF || x.cls == CLS_ZERO) return zero(f, sign);
+    if (y.cls == CLS_ZERO) { flags |= FLAG_DZ; return infinity(f, sign); }
+
+    // both significands to [2^63, 2^64), at least 62 quotient bits plus a sticky bit
+    int la = 64 - bit_length(x.sig), lb = 64 - bit_length(y.sig);
+    u128 num = (u128)x.sig << (la + 62);
+    u128 den = (u128)y.sig << lb;
+    u128 q = num / den;
+    bool rem = (num % den) != 0;
+    return round_pack(f, sign, (x.exp - la - 62) - (y.exp - lb) - 1, (q << 1) | rem, rm, flags);
+}
+
+inline u128 isqrt(u128 x, bool& inexact) {
+    u128 root = 0, bit = (u128)1 << 126;
+    while (bit > x) bit >>= 2;
+    while (bit) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    inexact = x != 0;
+    return root;
+}
+
+inline uint64_t sqrt(Format f, uint64_t a, int rm, uint8_t& flags) {
+    Unpacked x = unpack(f, a);
+    if (is_nan(x)) { flags |= FLAG_NV; return canonical_nan(f); }
+    if (x.cls == CLS_ZERO) return zero(f, x.sign);
+    if (x.sign) { flags |= FLAG_NV; return canonical_nan(f); }
+    if (x.cls == CLS_INF) return infinity(f, 0);
+
+    // significand to bit 124 or 125 with an even exponent, ~63 root bits plus a sticky bit
+    int s = 125 - bit_length(x.sig);
+    if ((x.exp - s) & 1) s++;
+    bool inexact;
+    u128 root = isqrt((u128)x.sig << s, inexact);
+    return round_pack(f, 0, (x.exp - s) / 2 - 1, (root << 1) | inexact, rm, flags);
+}
+
+inline uint64_t fma(Format f, uint64_t a, uint64_t b, uint64_t c, bool negate_product, bool negate_addend, int rm, uint8_t& flags) {
+    Unpacked x = unpack(f, a), y = unpack(f, b), z = unpack(f, c);
+    if (is_nan(x) || is_nan(y) || is_nan(z)) { flags |= FLAG_NV; return canonical_nan(f); }
+    bool sp = x.sign ^ y.sign ^ negate_product;
+    z.sign ^= negate_addend;
+    if ((x.cls == CLS_INF && y.cls == CLS_ZERO) || (x.cls == CLS_ZERO && y.cls == CLS_INF)) {
+        flags |= FLAG_NV; return canonical_nan(f);
+    }
+    if (x.cls == CLS_INF || y.cls == CLS_INF) {
+        if (z.cls == CLS_INF && z.sign != sp) { flags |= FLAG_NV; return canonical_nan(f); }
+        return infinity(f, sp);
+    }
+    if (z.cls == CLS_INF) return infinity(f, z.sign);
+    if (x.cls == CLS_ZERO || y.cls == CLS_ZERO) {
+        if (z.cls == CLS_ZERO) return zero(f, (sp == z.sign) ? sp : rm == RDN);
+        return repack(f, z);
+    }
+    u128 prod = (u128)x.sig * y.sig;
+    if (z.cls == CLS_ZERO) return round_pack(f, sp, x.exp + y.exp, prod, rm, flags);
+    return add_finite(f, sp, x.exp + y.exp, prod, z.sign, z.exp, z.sig, rm, flags);
+}
+
+// CMP_EQ / CMP_LT / CMP_LE, any other func3 returns 0
+inline uint64_t compare(Format f, uint64_t a, uint64_t b, int func3, uint8_t& flags) {
+    Unpacked x = unpack(f, a), y = unpack(f, b);
+    if (x.cls == CLS_SNAN || y.cls == CLS_SNAN) flags |= FLAG_NV;
+    if (is_nan(x) || is_nan(y)) return 0;
+
+    // order on sign-magnitude: both zeros are equal, otherwise bits compare as magnitudes
+    uint64_t sign_bit = 1ull << (f.exp_w + f.man_w);
+    uint64_t ma = a & (sign_bit - 1), mb = b & (sign_bit - 1);
+    bool eq, lt;
+    if (x.cls == CLS_ZERO && y.cls == CLS_ZERO) {
+        eq = true; lt = false;
+    } else if (x.sign != y.sign) {
+        eq = false; lt = x.sign;
+    } else {
+        eq = ma == mb;
+        lt = x.sign ? ma > mb : ma < mb;
+    }
+    switch (func3) {
+        case CMP_EQ: return eq;
+        case CMP_LT: return lt;
+        case CMP_LE: return eq || lt;
+        default:     return 0;
+    }
+}
+
+// --- Conversions ---
+inline uint64_t convert(Format from, Format to, uint64_t a, int rm, uint8_t& flags) {
+    Unpacked x = unpack(from, a);
+    if (is_nan(x)) { flags |= FLAG_NV; return canonical_nan(to); }
+    if (x.cls == CLS_INF) return infinity(to, x.sign);
+    if (x.cls == CLS_ZERO) return zero(to, x.sign);
+    return round_pack(to, x.sign, x.exp, x.sig, rm, flags);
+}
+
+inline uint64_t to_int(Format f, uint64_t a, bool is_unsigned, int rm, uint8_t& flags) {
+    const uint64_t INT_MAX_VAL = 0x7FFFFFFF, INT_MIN_VAL = 0x80000000, UINT_MAX_VAL = 0xFFFFFFFF;
+    Unpacked x = unpack(f, a);
+    if (is_nan(x)) { flags |= FLAG_NV; return is_unsigned ? UINT_MAX_VAL : INT_MIN_VAL; }
+    if (x.cls == CLS_INF) {
+        if (is_unsigned) {
+            flags |= x.sign ? FLAG_NV : FLAG_NV | FLAG_OF;
+            return x.sign ? 0 : UINT_MAX_VAL;
+        }
+        flags |= FLAG_NV | FLAG_OF;
+        return x.sign ? INT_MIN_VAL : INT_MAX_VAL;
+    }
+    if (x.cls == CLS_ZERO) return 0;
+
+    // rounded magnitude, anything at or above 2^40 is simply out of range
+    u128 mag;
+    bool inexact = false;
+    if (x.exp >= 0) {
+        mag = (x.exp > 40) ? ((u128)1 << 40) : ((u128)x.sig << x.exp);
+    } else {
+        bool g, st;
+        shift_round(x.sig, -x.exp, mag, g, st);
+        inexact = g || st;
+        if (round_increment(rm, x.sign, mag & 1, g, st)) mag++;
+    }
+
+    if (is_unsigned) {
+        if (x.sign && mag != 0) { flags |= FLAG_NV; return 0; }
+        if (mag > UINT_MAX_VAL) { flags |= FLAG_NV | FLAG_OF | FLAG_NX; return UINT_MAX_VAL; }
+        if (inexact) flags |= FLAG_NX;
+        return (uint64_t)mag;
+    }
+    if (mag > (x.sign ? INT_MIN_VAL : INT_MAX_VAL)) {
+        flags |= FLAG_NV | FLAG_OF | FLAG_NX;
+        return x.sign ? INT_MIN_VAL : INT_MAX_VAL;
+    }
+    if (inexact) flags |= FLAG_NX;
+    return x.sign ? (uint32_t)(0u - (uint32_t)mag) : (uint64_t)mag;
+}
+
+inline uint64_t from_int(Format f, uint32_t a, bool is_unsigned, int rm, uint8_t& flags) {
+    bool sign = !is_unsigned && (a >> 31);
+    uint32_t mag = sign ? 0u - a : a;
+    if (mag == 0) return zero(f, 0);
+    return round_pack(f, sign, 0, mag, rm, flags);
+}
+
+// --- Opcode Dispatch ---
+inline RefResult execute_ieee(uint8_t func7, uint8_t func3, uint8_t rs2, uint64_t a, uint64_t b, uint64_t c) {
+    RefResult r = {0, 0, 0};
+    uint8_t lane_flags[4] = {0, 0, 0, 0};
+    uint8_t& fl = lane_flags[0];
+    int rm = func3;
+    bool is_unsigned = rs2 & 1;
+    bool sub = (func7 >> 2) & 1;
+    bool neg_prod = (func7 >> 3) & 1, neg_add = (func7 >> 2) & 1;
+    Format half = ((func7 >> 6) & 1) ? FMT_B : FMT_H;         // arithmetic BF16 select
+    Format half_cvt = ((func7 >> 4) & 1) ? FMT_B : FMT_H;     // conversion BF16 select
+
+    auto lane32 = [](uint64_t v, int l) { return (v >> (32 * l)) & 0xFFFFFFFF; };
+    auto lane16 = [](uint64_t v, int l) { return (v >> (16 * l)) & 0xFFFF; };
+
+    switch (func7) {
+        case OP_FADD_S: case OP_FSUB_S: r.result = add(FMT_S, lane32(a, 0), lane32(b, 0), sub, rm, fl); break;
+        case OP_FADD_D: case OP_FSUB_D: r.result = add(FMT_D, a, b, sub, rm, fl); break;
+        case OP_FMUL_S:   r.result = mul(FMT_S, lane32(a, 0), lane32(b, 0), rm, fl); break;
+        case OP_FMUL_D:   r.result = mul(FMT_D, a, b, rm, fl); break;
+        case OP_FDIV_S:   r.result = div(FMT_S, lane32(a, 0), lane32(b, 0), rm, fl); break;
+        case OP_FDIV_D:   r.result = div(FMT_D, a, b, rm, fl); break;
+        case OP_FSQRT_S:  r.result = sqrt(FMT_S, lane32(a, 0), rm, fl); break;
+        case OP_FSQRT_D:  r.result = sqrt(FMT_D, a, rm, fl); break;
+        case OP_FMADD_S: case OP_FMSUB_S: case OP_FNMSUB_S: case OP_FNMADD_S:
+            r.result = fma(FMT_S, lane32(a, 0), lane32(b, 0), lane32(c, 0), neg_prod, neg_add, rm, fl); break;
+        case OP_FMADD_D: case OP_FMSUB_D: case OP_FNMSUB_D: case OP_FNMADD_D:
+            r.result = fma(FMT_D, a, b, c, neg_prod, neg_add, rm, fl); break;
+        case OP_FCMP_S:   r.result = compare(FMT_S, lane32(a, 0), lane32(b, 0), func3, fl); break;
+        case OP_FCMP_D:   r.result = compare(FMT_D, a, b, func3, fl); break;
+        case OP_FCVT_D_S: r.result = convert(FMT_S, FMT_D, lane32(a, 0), rm, fl); break;
+        case OP_FCVT_S_D: r.result = convert(FMT_D, FMT_S, a, rm, fl); break;
+        case OP_FCVT_W_S: r.result = to_int(FMT_S, lane32(a, 0), is_unsigned, rm, fl); break;
+        case OP_FCVT_W_D: r.result = to_int(FMT_D, a, is_unsigned, rm, fl); break;
+        case OP_FCVT_S_W: r.result = from_int(FMT_S, lane32(a, 0), is_unsigned, rm, fl); break;
+        case OP_FCVT_D_W: r.result = from_int(FMT_D, lane32(a, 0), is_unsigned, rm, fl); break;
+
+        // packed FP32x2, lane 1 in [63:32]
+        case OP_FADD_PS: case OP_FSUB_PS: case OP_FMUL_PS: case OP_FDIV_PS:
+        case OP_FCMP_PS: case OP_FCVT_W_PS: case OP_FCVT_PS_W:
+            for (int l = 0; l < 2; l++) {
+                uint64_t x = lane32(a, l), y = lane32(b, l), v = 0;
+                uint8_t& lf = lane_flags[l];
+                switch (func7) {
+                    case OP_FADD_PS: case OP_FSUB_PS: v = add(FMT_S, x, y, sub, rm, lf); break;
+                    case OP_FMUL_PS:   v = mul(FMT_S, x, y, rm, lf); break;
+                    case OP_FDIV_PS:   v = div(FMT_S, x, y, rm, lf); break;
+                    case OP_FCMP_PS:   v = compare(FMT_S, x, y, func3, lf); break;
+                    case OP_FCVT_W_PS: v = to_int(FMT_S, x, is_unsigned, rm, lf); break;
+                    case OP_FCVT_PS_W: v = from_int(FMT_S, x, is_unsigned, rm, lf); break;
+                }
+                r.result |= v << (32 * l);
+            }
+            break;
+
+        // packed 16-bit x4, lane n in [16n+15:16n]
+        case OP_FADD_H4: case OP_FSUB_H4: case OP_FADD_B4: case OP_FSUB_B4:
+        case OP_FMUL_H4: case OP_FMUL_B4:
+        case OP_FMADD_H4: case OP_FMSUB_H4: case OP_FNMSUB_H4: case OP_FNMADD_H4:
+        case OP_FMADD_B4: case OP_FMSUB_B4: case OP_FNMSUB_B4: case OP_FNMADD_B4:
+            for (int l = 0; l < 4; l++) {
+                uint64_t x = lane16(a, l), y = lane16(b, l), z = lane16(c, l), v;
+                uint8_t& lf = lane_flags[l];
+                if ((func7 & 0b0111011) == (OP_FADD_H4 & 0b0111011)) v = add(half, x, y, sub, rm, lf);
+                else if ((func7 & 0b0111111) == OP_FMUL_H4) v = mul(half, x, y, rm, lf);
+                else v = fma(half, x, y, z, neg_prod, neg_add, rm, lf);
+                r.result |= v << (16 * l);
+            }
+            break;
+
+        case OP_FCVT_H4_S: case OP_FCVT_B4_S:
+            for (int l = 0; l < 4; l++) {
+                uint64_t x = lane32(l < 2 ? a : b, l % 2);
+                r.result |= convert(FMT_S, half_cvt, x, rm, lane_flags[l]) << (16 * l);
+            }
+            break;
+        case OP_FCVT_H4_D: case OP_FCVT_B4_D:
+            r.result = convert(FMT_D, half_cvt, a, rm, fl);
+            break;
+        case OP_FCVT_PS_H4: case OP_FCVT_PS_B4:
+            for (int l = 0; l < 2; l++) {
+                uint64_t x = lane16(a, 2 * (rs2 & 1) + l);
+                r.result |= convert(half_cvt, FMT_S, x, rm, lane_flags[l]) << (32 * l);
+            }
+            break;
+        case OP_FCVT_D_H4: case OP_FCVT_D_B4:
+            r.result = convert(half_cvt, FMT_D, lane16(a, rs2 & 3), rm, fl);
+            break;
+
+        default:
+            r.result = 0x7FF8000000000000;
+            fl = FLAG_NV;
+            break;
+    }
+
+    for (int l = 0; l < 4; l++) {
+        r.flags |= lane_flags[l];
+        r.flag_lanes |= (uint32_t)lane_flags[l] << (5 * l);
+    }
+    return r;
+}
+
+// --- Flush-to-zero Mode ---
+// Lane layout of an op's FP inputs and of a result that can be tiny, for the units that read
+// denormals as zero and flush tiny results. lanes == 0 means nothing to flush.
+struct LaneLayout {
+    Format fmt;
+    int    lanes;
+    int    stride;
+};
+
+inline void ftz_layouts(uint8_t func7, LaneLayout& in, LaneLayout& out) {
+    const LaneLayout none = {FMT_S, 0, 0}, s = {FMT_S, 1, 32}, ps = {FMT_S, 2, 32}, d = {FMT_D, 1, 64};
+    const LaneLayout h = {FMT_H, 4, 16}, b = {FMT_B, 4, 16};
+    in = none;
+    out = none;
+    switch (func7) {
+        case OP_FADD_S: case OP_FSUB_S: case OP_FMUL_S: case OP_FDIV_S:
+        case OP_FMADD_S: case OP_FMSUB_S: case OP_FNMSUB_S: case OP_FNMADD_S: in = s; out = s; break;
+        case OP_FSQRT_S: case OP_FCMP_S: case OP_FCVT_D_S: case OP_FCVT_W_S: in = s; break;
+        case OP_FADD_PS: case OP_FSUB_PS: case OP_FMUL_PS: case OP_FDIV_PS: in = ps; out = ps; break;
+        case OP_FCMP_PS: case OP_FCVT_W_PS: in = ps; break;
+        case OP_FCVT_H4_S: in = ps; out = h; break;
+        case OP_FCVT_B4_S: in = ps; out = b; break;
+        case OP_FADD_D: case OP_FSUB_D: case OP_FMUL_D: case OP_FDIV_D:
+        case OP_FMADD_D: case OP_FMSUB_D: case OP_FNMSUB_D: case OP_FNMADD_D: in = d; out = d; break;
+        case OP_FSQRT_D: case OP_FCMP_D: case OP_FCVT_W_D: in = d; break;
+        case OP_FCVT_S_D: in = d; out = s; break;
+        case OP_FCVT_H4_D: in = d; out = h; break;
+        case OP_FCVT_B4_D: in = d; out = b; break;
+        case OP_FADD_H4: case OP_FSUB_H4: case OP_FMUL_H4:
+        case OP_FMADD_H4: case OP_FMSUB_H4: case OP_FNMSUB_H4: case OP_FNMADD_H4: in = h; out = h; break;
+        case OP_FCVT_PS_H4: case OP_FCVT_D_H4: in = h; break;
+        case OP_FADD_B4: case OP_FSUB_B4: case OP_FMUL_B4:
+        case OP_FMADD_B4: case OP_FMSUB_B4: case OP_FNMSUB_B4: case OP_FNMADD_B4: in = b; out = b; break;
+        case OP_FCVT_PS_B4: case OP_FCVT_D_B4: in = b; break;
+    }
+}
+
+// zeroes every denormal lane, keeping its sign, and with flag_lanes every smallest-normal lane
+// that raised UF (tiny, rounded up to it); returns which lanes were flushed
+inline unsigned flush_lanes(const LaneLayout& l, uint64_t& v, const uint32_t* flag_lanes = nullptr) {
+    unsigned flushed = 0;
+    for (int n = 0; n < l.lanes; n++) {
+        int shift = n * l.stride;
+        uint64_t e = (v >> (shift + l.fmt.man_w)) & exp_max(l.fmt);
+        uint64_t man = (v >> shift) & man_mask(l.fmt);
+        bool tiny_min_normal = flag_lanes && e == 1 && man == 0 && ((*flag_lanes >> (5 * n)) & FLAG_UF);
+        if ((e == 0 && man != 0) || tiny_min_normal) {
+            v &= ~(((exp_max(l.fmt) << l.fmt.man_w) | man_mask(l.fmt)) << shift);
+            flushed |= 1u << n;
+        }
+    }
+    return flushed;
+}
+
+inline RefResult execute(uint8_t func7, uint8_t func3, uint8_t rs2, uint64_t a, uint64_t b, uint64_t c, bool ftz = false) {
+    if (!ftz) return execute_ieee(func7, func3, rs2, a, b, c);
+    LaneLayout in, out;
+    ftz_layouts(func7, in, out);
+    flush_lanes(in, a);
+    flush_lanes(in, b);
+    flush_lanes(in, c);
+    RefResult r = execute_ieee(func7, func3, rs2, a, b, c);
+    unsigned flushed = flush_lanes(out, r.result, &r.flag_lanes);
+    for (int n = 0; n < 4; n++) {
+        if (flushed & (1u << n)) r.flag_lanes |= (uint32_t)(FLAG_UF | FLAG_NX) << (5 * n);
+    }
+    if (flushed) r.flags |= FLAG_UF | FLAG_NX;
+    return r;
+}
+
+} // namespace fpu_ref
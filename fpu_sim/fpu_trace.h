@@ -0,0 +1,78 @@
+#pragma once
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Binary FP operation trace: a 16-byte file header followed by fixed 48-byte little-endian
+// records, so record i sits at offset TRACE_HEADER_SIZE + i * sizeof(TraceRecord) and files
+// can be mmapped and walked without parsing.
+//
+//   header  "FPUTRACE" | u32 version | u32 record size
+//   record  func7 func3 rs2 valid | flags | pad[3] | u32 flag_lanes | u32 pad
+//           | operand_a | operand_b | operand_c | result
+//
+// In a captured trace TRACE_EXPECTED is optional; when set, result / flags / flag_lanes are
+// the expected values. Files written by the replay driver always carry TRACE_EXPECTED with
+// what the model produced, so they can be replayed again as golden traces. TRACE_FTZ is the
+// op's ftz input.
+const char TRACE_MAGIC[8] = {'F', 'P', 'U', 'T', 'R', 'A', 'C', 'E'};
+const uint32_t TRACE_VERSION = 1;
+const size_t TRACE_HEADER_SIZE = 16;
+
+const uint8_t TRACE_EXPECTED = 0x01;    // valid: result / flags / flag_lanes are meaningful
+const uint8_t TRACE_FTZ      = 0x02;    // valid: issued with ftz set
+
+struct TraceRecord {
+    uint8_t  func7;
+    uint8_t  func3;
+    uint8_t  rs2;
+    uint8_t  valid;
+    uint8_t  flags;         // {NV, DZ, OF, UF, NX}
+    uint8_t  pad0[3];
+    uint32_t flag_lanes;
+    uint32_t pad1;
+    uint64_t operand_a;
+    uint64_t operand_b;
+    uint64_t operand_c;
+    uint64_t result;
+};
+static_assert(sizeof(TraceRecord) == 48, "TraceRecord must stay 48 bytes");
+
+struct TraceHeader {
+    char     magic[8];
+    uint32_t version;
+    uint32_t record_size;
+};
+static_assert(sizeof(TraceHeader) == TRACE_HEADER_SIZE, "TraceHeader must stay 16 bytes");
+
+inline TraceHeader trace_header() {
+    TraceHeader h;
+    std::memcpy(h.magic, TRACE_MAGIC, sizeof(h.magic));
+    h.version = TRACE_VERSION;
+    h.record_size = sizeof(TraceRecord);
+    return h;
+}
+
+inline bool trace_header_ok(const TraceHeader& h) {
+    return std::memcmp(h.magic, TRACE_MAGIC, sizeof(h.magic)) == 0 && h.version == TRACE_VERSION && h.record_size == sizeof(TraceRecord);
+}
+
+// whole-file helpers for small traces (the directed test table); large traces are mmapped
+inline bool write_trace(const std::string& path, const std::vector<TraceRecord>& records) {
+    std::ofstream out(path, std::ios::binary);
+    TraceHeader h = trace_header();
+    out.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    out.write(reinterpret_cast<const char*>(records.data()), records.size() * sizeof(TraceRecord));
+    return (bool)out;
+}
+
+inline bool read_trace(const std::string& path, std::vector<TraceRecord>& records) {
+    std::ifstream in(path, std::ios::binary);
+    TraceHeader h;
+    if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)) || !trace_header_ok(h)) return false;
+    TraceRecord r;
+    while (in.read(reinterpret_cast<char*>(&r), sizeof(r))) records.push_back(r);
+    return true;
+}
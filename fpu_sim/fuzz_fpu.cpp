@@ -0,0 +1,642 @@
+#include <iostream>
+#include <fstream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <mutex>
+#include <atomic>
+#include <memory>
+#include <set>
+#include <cstdio>
+
+// Verilator header
+#include "verilated.h"
+
+// FPU Top module header
+#include "VFPU_Top.h"
+#include "fpu_opcodes.h"
+#include "fpu_ref.h"
+#include "fpu_gen.h"
+#include "fpu_cov.h"
+
+// Differential fuzzer: every thread runs its own VFPU_Top, streams random ops through it one per
+// cycle and checks result_out, the five flags and flag_lanes of each completed op against
+// fpu_ref::execute. Failing vectors are shrunk (rounding mode to RNE, ftz off, operand bits
+// cleared while the mismatch persists) and printed as TestCase rows for tb_fpu.cpp.
+//
+// The model is built with COVERAGE=1 and ops are drawn by a CovGuide (fpu_cov.h): ops whose unit
+// still has unreached bins are picked more often, and with probability --guide the operands are
+// a mutation of an earlier op that reached a rare bin instead of fresh ones (0: plain random).
+// The bin counts of all threads, plus those of an earlier run's --cov-in file, are reported and
+// written to --cov-out.
+//
+//   obj_fuzz/VFPU_Top [--threads N] [--ops N] [--seconds S] [--mix op:weight,...] [--rm 01234]
+//                     [--ftz P] [--guide P] [--seed S] [--max-failures N] [--out file]
+//                     [--cov-in file] [--cov-out file]
+//
+// With --sweep op it instead checks every input of a unary FP32 / INT32 op (see Exhaustive Sweep):
+//
+//   obj_fuzz/VFPU_Top --sweep fsqrt.s [--threads N] [--rm 01234] [--seconds S] [--state file]
+//                     [--max-failures N] [--out file]
+
+// --- Test Vectors ---
+using Vector = CovSeed;         // op_table index, func3, rs2, operands, ftz
+
+struct Observed {
+    uint64_t result;
+    uint8_t  flags;
+    uint32_t flag_lanes;
+    uint32_t cov;               // corner-path bins the op reached
+};
+
+struct Failure {
+    Vector   vec;
+    Observed got;
+};
+
+// --- Options & Shared State ---
+struct Options {
+    int threads = 0;
+    int64_t ops = 0;                    // 0: unlimited
+    double seconds = 60;                // 0: unlimited
+    std::string mix = "all";
+    std::string rounding = "01234";     // func3 values drawn for non-compare ops
+    double ftz = 0.25;                  // fraction of ops issued in flush-to-zero mode
+    double guide = 0.5;                 // fraction of ops mutated from the coverage corpus
+    uint64_t seed = 1;
+    size_t max_failures = 20;
+    std::string out_path = "fuzz_failures.txt";
+    std::string cov_in_path;            // counts of an earlier run to add to the report
+    std::string cov_path = "coverage_fuzz.txt";
+    std::string sweep;                  // op to sweep exhaustively instead of fuzzing
+    std::string state_path;             // sweep checkpoint, default sweep_<op>.state
+};
+
+struct Shared {
+    std::atomic<int64_t> ops_left{0};
+    std::atomic<uint64_t> checked{0};
+    std::atomic<bool> stop{false};
+    std::mutex lock;
+    std::vector<Failure> failures;
+    std::vector<uint64_t> fail_count;   // per op_table entry
+    uint64_t lost = 0;                  // ops that never completed
+    Coverage coverage;                  // merged as the threads finish
+    uint64_t last_new = 0;              // latest op (of its thread) that reached a new bin
+};
+
+Options options;
+std::vector<double> weights;
+std::vector<uint8_t> rounding_modes;
+
+// time is kept per VerilatedContext, this is only for runtimes that still ask for it
+double sc_time_stamp() {
+    return 0;
+}
+
+// --- Pipeline Configuration (Must match FPU_Top.v) ---
+const int TAG_WIDTH = 8;
+const int NUM_TAGS = 1 << TAG_WIDTH;
+const int DRAIN_TIMEOUT = 1000;
+
+// advance one clock cycle
+void tick(VFPU_Top* top) {
+    top->clk = 0;
+    top->eval();
+    top->clk = 1;
+    top->eval();
+}
+
+Vector random_vector(std::mt19937_64& rng, std::discrete_distribution<size_t>& pick) {
+    static const uint8_t compares[] = {CMP_LE, CMP_LT, CMP_EQ};
+    Vector v;
+    v.op = pick(rng);
+    const OpInfo& op = op_table[v.op];
+    v.func3 = op.compare ? compares[rng() % 3] : rounding_modes[rng() % rounding_modes.size()];
+    v.rs2 = op.max_rs2 ? rng() % (op.max_rs2 + 1) : 0;
+    v.a = gen_operand(rng, op.format);
+    v.b = gen_operand(rng, op.format);
+    v.c = gen_operand(rng, op.format);
+    v.ftz = std::generate_canonical<double, 53>(rng) < options.ftz;
+    return v;
+}
+
+fpu_ref::RefResult expected(const Vector& v) {
+    return fpu_ref::execute(op_table[v.op].func7, v.func3, v.rs2, v.a, v.b, v.c, v.ftz);
+}
+
+Observed observe(VFPU_Top* top) {
+    Observed o;
+    o.result = top->result_out;
+    o.flags = (top->flag_invalid << 4) | (top->flag_divbyzero << 3) | (top->flag_overflow << 2) | (top->flag_underflow << 1) | top->flag_inexact;
+    o.flag_lanes = top->flag_lanes;
+    o.cov = top->cov_out;
+    return o;
+}
+
+bool matches(const fpu_ref::RefResult& ref, const Observed& o) {
+    return ref.result == o.result && ref.flags == o.flags && ref.flag_lanes == o.flag_lanes;
+}
+
+void drive(VFPU_Top* top, const Vector& v, uint32_t tag) {
+    top->in_tag = tag;
+    top->func7 = op_table[v.op].func7;
+    top->func3 = v.func3;
+    top->rs2 = v.rs2;
+    top->ftz = v.ftz;
+    top->operand_a = v.a;
+    top->operand_b = v.b;
+    top->operand_c = v.c;
+}
+
+void reset(VFPU_Top* top) {
+    top->rst_n = 0;
+    top->in_valid = 0;
+    tick(top);
+    top->rst_n = 1;
+}
+
+std::string hex(uint64_t v, int width) {
+    std::ostringstream s;
+    s << "0x" << std::hex << std::uppercase << std::setfill('0') << std::setw(width) << v;
+    return s.str();
+}
+
+// op, func3, rs2, ftz and operands, for ops that have no result to report
+std::string describe(const Vector& v) {
+    std::ostringstream s;
+    s << op_table[v.op].name << " func3=" << (int)v.func3 << " rs2=" << (int)v.rs2 << (v.ftz ? " ftz" : "")
+      << " a=" << hex(v.a, 16) << " b=" << hex(v.b, 16) << " c=" << hex(v.c, 16);
+    return s.str();
+}
+
+// --- Worker ---
+// Issue every vector next() hands out, one per cycle, and pass each completed op with what the
+// FPU produced to check(). Returns once next() runs dry and the pipeline has drained, or once no
+// result has come back for DRAIN_TIMEOUT cycles. Returns the number of ops that never completed and
+// appends them to `lost`; the model still holds them, so reset it before streaming again.
+template <typename Next, typename Check>
+int stream(VFPU_Top* top, Next next, Check check, std::vector<Vector>& lost) {
+    std::vector<Vector> in_flight(NUM_TAGS);
+    std::vector<bool> busy(NUM_TAGS, false);
+    int pending = 0;
+    uint32_t next_tag = 0;
+    int idle_cycles = 0;
+    Vector v;
+    bool have_next = next(v);
+
+    while ((have_next || pending > 0) && idle_cycles < DRAIN_TIMEOUT) {
+        // setting inputs
+        bool issue = have_next && !busy[next_tag];
+        top->in_valid = issue;
+        if (issue) drive(top, v, next_tag);
+        top->eval();
+        bool accepted = issue && top->in_ready;
+
+        tick(top);
+
+        if (accepted) {
+            in_flight[next_tag] = v;
+            busy[next_tag] = true;
+            pending++;
+            next_tag = (next_tag + 1) % NUM_TAGS;
+            have_next = next(v);
+        }
+
+        // scoreboard
+        idle_cycles++;
+        if (top->out_valid && busy[top->out_tag]) {
+            check(in_flight[top->out_tag], observe(top));
+            busy[top->out_tag] = false;
+            pending--;
+            idle_cycles = 0;
+        }
+    }
+    top->in_valid = 0;
+    for (int tag = 0; tag < NUM_TAGS; tag++) {
+        if (busy[tag]) lost.push_back(in_flight[tag]);
+    }
+    return pending;
+}
+
+void fuzz_thread(int id, Shared& shared) {
+    std::mt19937_64 rng(options.seed + 0x9E3779B97F4A7C15ull * id);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+    CovGuide guide(weights, rounding_modes, options.guide, options.ftz);
+    std::unique_ptr<VerilatedContext> context(new VerilatedContext);
+    std::unique_ptr<VFPU_Top> top(new VFPU_Top(context.get()));
+    reset(top.get());
+
+    uint64_t local_checked = 0;
+    auto next = [&](Vector& v) {
+        if (shared.stop.load(std::memory_order_relaxed)) return false;
+        if (options.ops && shared.ops_left.fetch_sub(1) <= 0) return false;
+        v = options.guide > 0 ? guide.next(rng) : random_vector(rng, pick);
+        return true;
+    };
+    auto check = [&](const Vector& v, const Observed& got) {
+        guide.observe(v, got.cov);
+        if (!matches(expected(v), got)) {
+            std::lock_guard<std::mutex> guard(shared.lock);
+            shared.fail_count[v.op]++;
+            if (shared.failures.size() < options.max_failures) shared.failures.push_back({v, got});
+            if (options.max_failures && shared.failures.size() >= options.max_failures) shared.stop = true;
+        }
+        if (++local_checked % 4096 == 0) shared.checked.fetch_add(4096, std::memory_order_relaxed);
+    };
+    std::vector<Vector> lost;
+    stream(top.get(), next, check, lost);
+    shared.checked.fetch_add(local_checked % 4096, std::memory_order_relaxed);
+    if (!lost.empty()) {
+        std::lock_guard<std::mutex> guard(shared.lock);
+        for (const Vector& v : lost) std::cout << "Never completed: " << describe(v) << std::endl;
+        shared.lost += lost.size();
+    }
+    top->final();
+
+    std::lock_guard<std::mutex> guard(shared.lock);
+    shared.coverage.merge(guide.coverage);
+    shared.last_new = std::max(shared.last_new, guide.last_new);
+}
+
+// --- Exhaustive Sweep ---
+// Every 32-bit input of one unary FP32 / INT32 op, once per selected rounding mode and rs2 value
+// (W / WU). The space is cut into chunks that the threads claim one at a time; the state file is
+// rewritten after every finished chunk, so a killed sweep resumes without redoing or re-logging
+// anything. Mismatches go to a log file, one line each. A chunk with an op that never completes
+// is not finished: its lost ops and mismatches count for this run only, and a resumed sweep redoes it.
+const int CHUNK_BITS = 20;
+const uint64_t CHUNKS_PER_PASS = 1ull << (32 - CHUNK_BITS);
+
+struct Sweep {
+    size_t op;
+    int variants;                       // rs2 values per rounding mode
+    uint64_t num_chunks;
+    std::string state_path;
+    std::atomic<uint64_t> checked{0};
+    std::atomic<bool> stop{false};
+
+    std::mutex lock;                    // guards everything below
+    uint64_t watermark = 0;             // every chunk below is done
+    std::set<uint64_t> done;            // finished chunks above the watermark
+    uint64_t cursor = 0;                // next chunk to hand out
+    std::vector<uint64_t> mismatches;   // per pass
+    uint64_t lost = 0;                  // ops that never completed, not saved
+    uint64_t unfinished = 0;            // mismatches in chunks with lost ops, not saved
+    uint64_t logged = 0;
+    std::ofstream log;
+};
+
+std::string sweep_rounding() {
+    std::string s;
+    for (uint8_t rm : rounding_modes) s += (char)('0' + rm);
+    return s;
+}
+
+bool load_state(Sweep& s) {
+    std::ifstream in(s.state_path);
+    if (!in) return true;
+    std::string key, op, rm;
+    in >> key >> op >> key >> rm;
+    if (op != op_table[s.op].name || rm != sweep_rounding()) {
+        std::cerr << s.state_path << " belongs to a sweep of " << op << " --rm " << rm << std::endl;
+        return false;
+    }
+    std::string line;
+    while (std::getline(in, line)) {
+        std::istringstream fields(line);
+        fields >> key;
+        uint64_t v;
+        if (key == "watermark") fields >> s.watermark;
+        else if (key == "logged") fields >> s.logged;
+        else if (key == "done") while (fields >> v) s.done.insert(v);
+        else if (key == "mismatches") for (size_t i = 0; i < s.mismatches.size() && fields >> v; i++) s.mismatches[i] = v;
+    }
+    s.cursor = s.watermark;
+    return true;
+}
+
+// write to a temporary file and rename, so a kill never leaves a truncated state behind
+void save_state(Sweep& s) {
+    std::string tmp = s.state_path + ".tmp";
+    {
+        std::ofstream out(tmp);
+        out << "op " << op_table[s.op].name << "\nrm " << sweep_rounding() << "\n";
+        out << "watermark " << s.watermark << "\nlogged " << s.logged << "\ndone";
+        for (uint64_t c : s.done) out << " " << c;
+        out << "\nmismatches";
+        for (uint64_t m : s.mismatches) out << " " << m;
+        out << "\n";
+    }
+    std::rename(tmp.c_str(), s.state_path.c_str());
+}
+
+bool claim(Sweep& s, uint64_t& chunk) {
+    std::lock_guard<std::mutex> guard(s.lock);
+    while (s.cursor < s.num_chunks && s.done.count(s.cursor)) s.cursor++;
+    if (s.stop || s.cursor >= s.num_chunks) return false;
+    chunk = s.cursor++;
+    return true;
+}
+
+void finish(Sweep& s, uint64_t chunk, const std::vector<std::string>& lines, uint64_t count) {
+    std::lock_guard<std::mutex> guard(s.lock);
+    for (const std::string& line : lines) {
+        if (options.max_failures && s.logged >= options.max_failures) break;
+        s.log << line << "\n";
+        s.logged++;
+    }
+    s.log.flush();
+    s.mismatches[chunk / CHUNKS_PER_PASS] += count;
+    s.done.insert(chunk);
+    while (s.done.count(s.watermark)) s.done.erase(s.watermark++);
+    save_state(s);
+}
+
+// a chunk with lost ops stays out of the state file; its log lines are dropped as well, since the
+// chunk is redone on resume
+void abandon(Sweep& s, uint64_t chunk, const std::vector<Vector>& lost, uint64_t count) {
+    std::lock_guard<std::mutex> guard(s.lock);
+    for (const Vector& v : lost) std::cout << "Never completed (chunk " << chunk << "): " << describe(v) << std::endl;
+    s.lost += lost.size();
+    s.unfinished += count;
+}
+
+void sweep_thread(Sweep& s) {
+    std::unique_ptr<VerilatedContext> context(new VerilatedContext);
+    std::unique_ptr<VFPU_Top> top(new VFPU_Top(context.get()));
+    reset(top.get());
+
+    uint64_t chunk;
+    while (claim(s, chunk)) {
+        uint64_t pass = chunk / CHUNKS_PER_PASS;
+        Vector base = {s.op, rounding_modes[pass / s.variants], (uint8_t)(pass % s.variants), 0, 0, 0};
+        uint64_t input = (chunk % CHUNKS_PER_PASS) << CHUNK_BITS;
+        uint64_t end = input + (1ull << CHUNK_BITS);
+        std::vector<std::string> lines;
+        uint64_t count = 0;
+
+        auto next = [&](Vector& v) {
+            if (input == end) return false;
+            v = base;
+            v.a = input++;
+            return true;
+        };
+        auto check = [&](const Vector& v, const Observed& got) {
+            fpu_ref::RefResult ref = expected(v);
+            if (matches(ref, got)) return;
+            // op func3 rs2 input expected flags got flags
+            if (!options.max_failures || lines.size() < options.max_failures) {
+                std::ostringstream line;
+                line << op_table[v.op].name << " " << (int)v.func3 << " " << (int)v.rs2 << " " << hex(v.a, 8) << " "
+                     << hex(ref.result, 16) << " " << hex(ref.flags, 2) << " " << hex(got.result, 16) << " " << hex(got.flags, 2);
+                lines.push_back(line.str());
+            }
+            count++;
+        };
+        std::vector<Vector> lost;
+        if (stream(top.get(), next, check, lost)) {
+            abandon(s, chunk, lost, count);
+            reset(top.get());
+            continue;
+        }
+        s.checked.fetch_add(1ull << CHUNK_BITS, std::memory_order_relaxed);
+        finish(s, chunk, lines, count);
+    }
+    top->final();
+}
+
+int run_sweep(const std::string& name, const std::string& log_path) {
+    Sweep s;
+    s.op = op_table.size();
+    for (size_t i = 0; i < op_table.size(); i++) {
+        if (name == op_table[i].name) s.op = i;
+    }
+    if (s.op == op_table.size() || op_table[s.op].operands != 1 || !(op_table[s.op].format == F32 || op_table[s.op].format == I32)) {
+        std::cerr << "Cannot sweep " << name << ": not a unary FP32 / INT32 op" << std::endl;
+        return 2;
+    }
+    s.variants = op_table[s.op].max_rs2 + 1;
+    s.num_chunks = rounding_modes.size() * s.variants * CHUNKS_PER_PASS;
+    s.state_path = options.state_path.empty() ? "sweep_" + name + ".state" : options.state_path;
+    s.mismatches.assign(rounding_modes.size() * s.variants, 0);
+    if (!load_state(s)) return 2;
+    s.log.open(log_path, s.watermark || !s.done.empty() ? std::ios::app : std::ios::trunc);
+    if (s.watermark == 0 && s.done.empty()) s.log << "# op func3 rs2 input expected flags got flags\n";
+    uint64_t resumed = s.watermark + s.done.size();
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.threads; t++) workers.emplace_back(sweep_thread, std::ref(s));
+    while (options.seconds > 0 && !s.stop && s.watermark < s.num_chunks) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= options.seconds) s.stop = true;
+    }
+    for (std::thread& w : workers) w.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    static const char* modes[] = {"RNE", "RTZ", "RDN", "RUP", "RMM"};
+    uint64_t failed = 0;
+    std::cout << "\n----------------------------------------" << std::endl;
+    for (size_t pass = 0; pass < s.mismatches.size(); pass++) {
+        std::cout << "  " << name << " " << modes[rounding_modes[pass / s.variants]] << " rs2=" << pass % s.variants
+                  << ": " << s.mismatches[pass] << " mismatches" << std::endl;
+        failed += s.mismatches[pass];
+    }
+    if (s.lost) std::cout << "  " << s.lost << " op(s) never completed, " << s.unfinished << " mismatches in their chunks, which are left undone" << std::endl;
+    failed += s.lost + s.unfinished;
+    uint64_t chunks = s.watermark + s.done.size();
+    std::cout << "Sweep Summary: " << chunks << "/" << s.num_chunks << " chunks (" << resumed << " from " << s.state_path << "), "
+              << failed << " mismatches, log in " << log_path << ", " << s.checked << " ops in "
+              << std::fixed << std::setprecision(1) << seconds << " s" << std::endl;
+    if (chunks < s.num_chunks) std::cout << "Incomplete: run the same command again to resume." << std::endl;
+    std::cout << "----------------------------------------" << std::endl;
+
+    return failed ? 1 : 0;
+}
+
+// --- Shrinking ---
+// Run one op on an idle model and return what it produced.
+bool run_one(VFPU_Top* top, const Vector& v, Observed& got) {
+    top->in_valid = 1;
+    drive(top, v, 0);
+    for (int cycle = 0; cycle < DRAIN_TIMEOUT; cycle++) {
+        top->eval();
+        bool accepted = top->in_valid && top->in_ready;
+        tick(top);
+        if (accepted) top->in_valid = 0;
+        if (top->out_valid && !top->in_valid) {
+            got = observe(top);
+            return true;
+        }
+    }
+    return false;
+}
+
+Failure shrink(VFPU_Top* top, Failure f) {
+    auto still_fails = [&](const Vector& v, Observed& got) {
+        return run_one(top, v, got) && !matches(expected(v), got);
+    };
+    const OpInfo& op = op_table[f.vec.op];
+    Observed got;
+    Vector t = f.vec;
+
+    if (!op.compare && t.func3 != RNE) {
+        t.func3 = RNE;
+        if (still_fails(t, got)) { f.vec = t; f.got = got; } else t = f.vec;
+    }
+    if (t.ftz) {
+        t.ftz = false;
+        if (still_fails(t, got)) { f.vec = t; f.got = got; } else t = f.vec;
+    }
+    uint64_t* operands[3] = {&t.a, &t.b, &t.c};
+    for (int i = 0; i < 3; i++) {
+        uint64_t& x = *operands[i];
+        uint64_t keep = x;
+        x = 0;
+        if (still_fails(t, got)) { f.vec = t; f.got = got; continue; }
+        x = keep;
+        for (int bit = 63; bit >= 0; bit--) {
+            if (!((x >> bit) & 1)) continue;
+            x &= ~(1ull << bit);
+            if (still_fails(t, got)) { f.vec = t; f.got = got; }
+            else x |= 1ull << bit;
+        }
+    }
+    return f;
+}
+
+// --- Reporting ---
+std::string op_constant(const char* name) {
+    std::string s = "OP_";
+    for (const char* p = name; *p; p++) s += (*p == '.') ? '_' : (char)toupper(*p);
+    return s;
+}
+
+std::string func3_name(const OpInfo& op, uint8_t func3) {
+    static const char* modes[] = {"RNE", "RTZ", "RDN", "RUP", "RMM"};
+    if (op.compare) return func3 == CMP_EQ ? "CMP_EQ" : func3 == CMP_LT ? "CMP_LT" : "CMP_LE";
+    return func3 < 5 ? modes[func3] : std::to_string(func3);
+}
+
+// TestCase row in tb_fpu.cpp's layout, checking the full 64-bit result and every lane flag
+std::string test_case(const Failure& f, size_t index) {
+    const OpInfo& op = op_table[f.vec.op];
+    fpu_ref::RefResult ref = expected(f.vec);
+    std::ostringstream s;
+    s << "{\"FUZZ: " << op.name << " #" << index << "\", " << op_constant(op.name) << ", "
+      << func3_name(op, f.vec.func3) << ", " << (int)f.vec.rs2 << ", X2, "
+      << hex(f.vec.a, 16) << ", " << hex(f.vec.b, 16) << ", " << hex(ref.result, 16) << ", "
+      << ((ref.flags >> 4) & 1) << "," << ((ref.flags >> 3) & 1) << "," << ((ref.flags >> 2) & 1) << ","
+      << ((ref.flags >> 1) & 1) << "," << (ref.flags & 1) << ", "
+      << hex(f.vec.c, 16) << ", " << hex(ref.flag_lanes, 5) << (f.vec.ftz ? ", true" : "") << "},"
+      << "  // FPU: " << hex(f.got.result, 16) << ", flags " << hex(f.got.flags, 2) << ", lanes " << hex(f.got.flag_lanes, 5);
+    return s.str();
+}
+
+int main(int argc, char** argv, char** env) {
+    // initialize Verilator
+    Verilated::commandArgs(argc, argv);
+
+    // --- Options ---
+    bool seconds_set = false, max_failures_set = false, out_set = false;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string opt = argv[i];
+        if (opt == "--threads") options.threads = std::atoi(argv[i + 1]);
+        else if (opt == "--ops") options.ops = std::strtoll(argv[i + 1], nullptr, 0);
+        else if (opt == "--seconds") { options.seconds = std::atof(argv[i + 1]); seconds_set = true; }
+        else if (opt == "--mix") options.mix = argv[i + 1];
+        else if (opt == "--rm") options.rounding = argv[i + 1];
+        else if (opt == "--ftz") options.ftz = std::atof(argv[i + 1]);
+        else if (opt == "--guide") options.guide = std::atof(argv[i + 1]);
+        else if (opt == "--seed") options.seed = std::strtoull(argv[i + 1], nullptr, 0);
+        else if (opt == "--max-failures") { options.max_failures = std::strtoull(argv[i + 1], nullptr, 0); max_failures_set = true; }
+        else if (opt == "--out") { options.out_path = argv[i + 1]; out_set = true; }
+        else if (opt == "--cov-in") options.cov_in_path = argv[i + 1];
+        else if (opt == "--cov-out") options.cov_path = argv[i + 1];
+        else if (opt == "--sweep") options.sweep = argv[i + 1];
+        else if (opt == "--state") options.state_path = argv[i + 1];
+        else {
+            std::cerr << "Unknown option: " << opt << std::endl;
+            return 2;
+        }
+    }
+    if (options.threads <= 0) options.threads = std::max(1u, std::thread::hardware_concurrency());
+    if (!parse_op_mix(options.mix, weights)) return 2;
+    for (char ch : options.rounding) {
+        if (ch < '0' || ch > '4') {
+            std::cerr << "Unknown rounding mode: " << ch << std::endl;
+            return 2;
+        }
+        rounding_modes.push_back(ch - '0');
+    }
+    if (rounding_modes.empty()) rounding_modes.push_back(RNE);
+
+    // a sweep runs to completion unless limited, and --max-failures only caps the log
+    if (!options.sweep.empty()) {
+        if (!seconds_set) options.seconds = 0;
+        if (!max_failures_set) options.max_failures = 100000;
+        return run_sweep(options.sweep, out_set ? options.out_path : "sweep_" + options.sweep + ".log");
+    }
+
+    // --- Fuzz ---
+    Shared shared;
+    shared.ops_left = options.ops;
+    shared.fail_count.assign(op_table.size(), 0);
+    if (!options.cov_in_path.empty() && !shared.coverage.read(options.cov_in_path)) {
+        std::cerr << options.cov_in_path << ": cannot read coverage counts" << std::endl;
+        return 2;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    std::vector<std::thread> workers;
+    for (int t = 0; t < options.threads; t++) workers.emplace_back(fuzz_thread, t, std::ref(shared));
+    while (options.seconds > 0 && !shared.stop) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(100));
+        double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        if (elapsed >= options.seconds) shared.stop = true;
+        if (options.ops && shared.ops_left <= 0) break;
+    }
+    for (std::thread& w : workers) w.join();
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // --- Shrink & Report ---
+    std::ofstream out(options.out_path);
+    if (!shared.failures.empty()) {
+        std::unique_ptr<VerilatedContext> context(new VerilatedContext);
+        std::unique_ptr<VFPU_Top> top(new VFPU_Top(context.get()));
+        reset(top.get());
+        std::cout << "Shrunk failing vectors (also in " << options.out_path << "):" << std::endl;
+        std::set<std::string> seen;     // failures often shrink to the same vector
+        for (size_t i = 0; i < shared.failures.size(); i++) {
+            std::string row = test_case(shrink(top.get(), shared.failures[i]), i);
+            if (!seen.insert(row.substr(row.find(',') + 1)).second) continue;
+            std::cout << "    " << row << std::endl;
+            out << "            " << row << "\n";
+        }
+        top->final();
+    }
+
+    uint64_t checked = shared.checked;
+    uint64_t failed = 0;
+    std::cout << "\n----------------------------------------" << std::endl;
+    for (size_t i = 0; i < op_table.size(); i++) {
+        if (shared.fail_count[i]) std::cout << "  " << std::left << std::setw(12) << op_table[i].name << shared.fail_count[i] << " mismatches" << std::endl;
+        failed += shared.fail_count[i];
+    }
+    std::cout << "Fuzz Summary: " << checked << " ops checked, " << failed << " mismatches, " << shared.lost << " lost, " << options.threads << " threads, "
+              << std::fixed << std::setprecision(1) << seconds << " s (" << std::setprecision(0) << checked / seconds * 3600 << " ops/hour)" << std::endl;
+    std::cout << "Coverage: " << shared.coverage.reached() << " / " << shared.coverage.bins() << " bins, last new bin at op "
+              << shared.last_new << " of its thread, counts in " << options.cov_path << std::endl;
+    shared.coverage.report(std::cout);
+    shared.coverage.write(options.cov_path);
+    std::cout << "----------------------------------------" << std::endl;
+
+    return (failed || shared.lost) ? 1 : 0;
+}
@@ -0,0 +1,243 @@
+#include <iostream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <algorithm>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Verilator header
+#include "verilated.h"
+
+// FPU Top module header
+#include "VFPU_Top.h"
+#include "fpu_opcodes.h"
+#include "fpu_trace.h"
+
+// Trace replay driver: streams a binary trace (fpu_trace.h) through the model one op per cycle.
+// The input is mmapped one batch of records at a time and read in place; results are written
+// in place into an mmapped output file of the same layout. Memory use is bounded by the batch
+// size, not by the trace size.
+//
+//   obj_replay/VFPU_Top --in trace.bin [--out results.bin] [--batch N] [--max-report N]
+//
+// Records carrying TRACE_EXPECTED are checked against what the model produced.
+
+// simulate clock
+vluint64_t main_time = 0;
+double sc_time_stamp() {
+    return main_time;
+}
+
+// --- Pipeline Configuration (Must match FPU_Top.v) ---
+const int TAG_WIDTH = 8;
+const int NUM_TAGS = 1 << TAG_WIDTH;
+const int DRAIN_TIMEOUT = 1000;
+
+// advance one clock cycle
+void tick(VFPU_Top* top) {
+    top->clk = 0;
+    top->eval();
+    main_time++;
+
+    top->clk = 1;
+    top->eval();
+    main_time++;
+}
+
+// --- Mapped File Window ---
+// Maps bytes [offset, offset + length) of a file. mmap wants a page-aligned offset, so the
+// mapping starts at the page below and data points at the requested byte.
+struct Window {
+    void*  base = nullptr;
+    size_t mapped = 0;
+    char*  data = nullptr;
+
+    bool map(int fd, uint64_t offset, size_t length, bool writable) {
+        uint64_t page = sysconf(_SC_PAGESIZE);
+        uint64_t start = offset / page * page;
+        mapped = length + (offset - start);
+        base = mmap(nullptr, mapped, writable ? PROT_READ | PROT_WRITE : PROT_READ, writable ? MAP_SHARED : MAP_PRIVATE, fd, start);
+        if (base == MAP_FAILED) {
+            base = nullptr;
+            return false;
+        }
+        if (!writable) madvise(base, mapped, MADV_SEQUENTIAL);
+        data = static_cast<char*>(base) + (offset - start);
+        return true;
+    }
+    void unmap() {
+        if (base) munmap(base, mapped);
+        base = nullptr;
+    }
+};
+
+int main(int argc, char** argv, char** env) {
+    // initialize Verilator
+    Verilated::commandArgs(argc, argv);
+
+    // --- Options ---
+    std::string in_path, out_path;
+    uint64_t batch = 1 << 20;
+    uint64_t max_report = 10;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string opt = argv[i];
+        if (opt == "--in") in_path = argv[i + 1];
+        else if (opt == "--out") out_path = argv[i + 1];
+        else if (opt == "--batch") batch = std::max(1ull, std::strtoull(argv[i + 1], nullptr, 0));
+        else if (opt == "--max-report") max_report = std::strtoull(argv[i + 1], nullptr, 0);
+        else {
+            std::cerr << "Unknown option: " << opt << std::endl;
+            return 2;
+        }
+    }
+    if (in_path.empty()) {
+        std::cerr << "Usage: " << argv[0] << " --in trace.bin [--out results.bin] [--batch N] [--max-report N]" << std::endl;
+        return 2;
+    }
+
+    // --- Open Trace ---
+    int in_fd = open(in_path.c_str(), O_RDONLY);
+    struct stat st;
+    TraceHeader header;
+    if (in_fd < 0 || fstat(in_fd, &st) != 0 || pread(in_fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header) || !trace_header_ok(header)) {
+        std::cerr << in_path << ": not a readable FPU trace" << std::endl;
+        return 2;
+    }
+    uint64_t body = st.st_size - TRACE_HEADER_SIZE;
+    if (body % sizeof(TraceRecord)) {
+        std::cerr << in_path << ": truncated record at the end" << std::endl;
+        return 2;
+    }
+    uint64_t count = body / sizeof(TraceRecord);
+
+    int out_fd = -1;
+    if (!out_path.empty()) {
+        out_fd = open(out_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (out_fd < 0 || ftruncate(out_fd, st.st_size) != 0 || pwrite(out_fd, &header, sizeof(header), 0) != (ssize_t)sizeof(header)) {
+            std::cerr << out_path << ": cannot create" << std::endl;
+            return 2;
+        }
+    }
+
+    // initialize FPU
+    VFPU_Top* top = new VFPU_Top;
+
+    // reset
+    top->rst_n = 0;
+    top->in_valid = 0;
+    tick(top);
+    top->rst_n = 1;
+
+    // --- Replay, one mapped batch at a time; the pipeline drains at every batch boundary ---
+    std::vector<int64_t> in_flight(NUM_TAGS, -1);   // tag -> record index within the batch
+    uint64_t completed = 0;
+    uint64_t checked = 0;
+    uint64_t mismatches = 0;
+    uint64_t cycle = 0;
+    bool lost = false;
+
+    auto host_start = std::chrono::steady_clock::now();
+    for (uint64_t first = 0; first < count && !lost; first += batch) {
+        uint64_t n = std::min(batch, count - first);
+        uint64_t offset = TRACE_HEADER_SIZE + first * sizeof(TraceRecord);
+        Window in_win, out_win;
+        if (!in_win.map(in_fd, offset, n * sizeof(TraceRecord), false) ||
+            (out_fd >= 0 && !out_win.map(out_fd, offset, n * sizeof(TraceRecord), true))) {
+            std::cerr << "mmap failed at record " << first << std::endl;
+            return 2;
+        }
+        const TraceRecord* in = reinterpret_cast<const TraceRecord*>(in_win.data);
+        TraceRecord* out = reinterpret_cast<TraceRecord*>(out_win.data);
+
+        uint64_t next = 0;
+        uint64_t done = 0;
+        uint32_t next_tag = 0;
+        int idle_cycles = 0;
+        while (done < n && idle_cycles < DRAIN_TIMEOUT) {
+            // setting inputs
+            bool issue = (next < n) && (in_flight[next_tag] < 0);
+            top->in_valid = issue;
+            if (issue) {
+                const TraceRecord& r = in[next];
+                top->in_tag = next_tag;
+                top->func7 = r.func7;
+                top->func3 = r.func3;
+                top->rs2 = r.rs2;
+                top->ftz = (r.valid & TRACE_FTZ) != 0;
+                top->operand_a = r.operand_a;
+                top->operand_b = r.operand_b;
+                top->operand_c = r.operand_c;
+            }
+            top->eval();
+            bool accepted = issue && top->in_ready;
+
+            tick(top);
+            cycle++;
+
+            if (accepted) {
+                in_flight[next_tag] = next++;
+                next_tag = (next_tag + 1) % NUM_TAGS;
+            }
+
+            // completion
+            idle_cycles++;
+            if (top->out_valid && in_flight[top->out_tag] >= 0) {
+                uint64_t i = in_flight[top->out_tag];
+                in_flight[top->out_tag] = -1;
+                done++;
+                idle_cycles = 0;
+
+                const TraceRecord& r = in[i];
+                uint8_t flags = (top->flag_invalid << 4) | (top->flag_divbyzero << 3) | (top->flag_overflow << 2) | (top->flag_underflow << 1) | top->flag_inexact;
+                if (r.valid & TRACE_EXPECTED) {
+                    checked++;
+                    if (top->result_out != r.result || flags != r.flags || top->flag_lanes != r.flag_lanes) {
+                        if (mismatches++ < max_report) {
+                            std::cout << "\033[31m[FAIL]\033[0m record " << std::dec << first + i << std::hex << std::setfill('0')
+                                      << ": func7 0x" << std::setw(2) << (int)r.func7 << " func3 " << (int)r.func3 << " rs2 " << (int)r.rs2
+                                      << " a 0x" << std::setw(16) << r.operand_a << " b 0x" << std::setw(16) << r.operand_b << " c 0x" << std::setw(16) << r.operand_c
+                                      << "\n    got 0x" << std::setw(16) << top->result_out << " flags 0x" << std::setw(2) << (int)flags << " lanes 0x" << std::setw(5) << top->flag_lanes
+                                      << ", expected 0x" << std::setw(16) << r.result << " flags 0x" << std::setw(2) << (int)r.flags << " lanes 0x" << std::setw(5) << r.flag_lanes
+                                      << std::setfill(' ') << std::dec << std::endl;
+                        }
+                    }
+                }
+                if (out) {
+                    out[i] = r;
+                    out[i].valid = r.valid | TRACE_EXPECTED;
+                    out[i].result = top->result_out;
+                    out[i].flags = flags;
+                    out[i].flag_lanes = top->flag_lanes;
+                }
+            }
+        }
+        completed += done;
+        if (done < n) {
+            std::cerr << (n - done) << " op(s) of the batch at record " << first << " never completed" << std::endl;
+            lost = true;
+        }
+        in_win.unmap();
+        out_win.unmap();
+    }
+    double host_seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - host_start).count();
+    top->final();
+    delete top;
+    close(in_fd);
+    if (out_fd >= 0) close(out_fd);
+
+    // Summary
+    std::cout << "\n----------------------------------------" << std::endl;
+    std::cout << "Replay Summary: " << completed << " / " << count << " records, " << checked << " checked, " << mismatches << " mismatches, "
+              << cycle << " cycles, " << std::fixed << std::setprecision(0) << (host_seconds > 0 ? completed / host_seconds : 0.0) << " ops/s" << std::endl;
+    if (!out_path.empty()) std::cout << "Results written to " << out_path << std::endl;
+    std::cout << "----------------------------------------" << std::endl;
+
+    return (completed == count && mismatches == 0) ? 0 : 1;
+}
@@ -0,0 +1,82 @@
+#!/bin/sh
+# Collects cell count and logic depth of the Yosys runs of make synth-report into a JSON report
+# and compares them with a baseline report. Exits 1 when a unit's cell count or depth grew by
+# more than the tolerance, so the target fails on an area or critical-path regression. Exits 2,
+# without writing the report, when a unit has no cell count or no ltp path length.
+#
+#   synth_report.sh DIR REPORT BASELINE TOLERANCE_PERCENT UNIT...
+#
+# DIR holds <unit>.stat.json (yosys stat -json) and <unit>.log (with ltp -noff) per unit. The
+# report keeps one unit per line so the baseline can be read back without a JSON parser.
+
+dir=$1
+report=$2
+baseline=$3
+tolerance=$4
+shift 4
+
+cells_of() {   # cells_of UNIT
+    grep -o '"num_cells": *[0-9]*' "$dir/$1.stat.json" 2>/dev/null | tail -1 | grep -o '[0-9]*$'
+}
+
+depth_of() {   # depth_of UNIT
+    grep -o 'Longest topological path in .* (length=[0-9]*)' "$dir/$1.log" 2>/dev/null | tail -1 | grep -o '[0-9]*)$' | tr -d ')'
+}
+
+# --- Check ---
+# a unit without a cell count or an ltp line did not synthesize; reading it as 0 would pass as
+# an improvement
+missing=0
+for unit in "$@"; do
+    if [ -z "$(cells_of "$unit")" ]; then
+        echo "$unit: no num_cells in $dir/$unit.stat.json" >&2; missing=1
+    fi
+    if [ -z "$(depth_of "$unit")" ]; then
+        echo "$unit: no ltp path length in $dir/$unit.log" >&2; missing=1
+    fi
+done
+[ $missing -ne 0 ] && exit 2
+
+# --- Report ---
+{
+    echo "{"
+    sep=""
+    for unit in "$@"; do
+        printf '%s  "%s": {"cells": %s, "depth": %s}' "$sep" "$unit" "$(cells_of "$unit")" "$(depth_of "$unit")"
+        sep=",
+"
+    done
+    echo ""
+    echo "}"
+} > "$report"
+
+# --- Compare ---
+if [ ! -f "$baseline" ]; then
+    cat "$report"
+    echo "No baseline $baseline, run make synth-baseline to keep this report as one."
+    exit 0
+fi
+
+field() {   # field FILE UNIT cells|depth
+    grep "\"$2\":" "$1" | sed -n "s/.*\"$3\": \([0-9]*\).*/\1/p"
+}
+
+status=0
+printf '%-16s %10s %10s %8s %8s %8s %8s\n' unit cells baseline change depth baseline change
+for unit in "$@"; do
+    cells=$(field "$report" "$unit" cells)
+    depth=$(field "$report" "$unit" depth)
+    base_cells=$(field "$baseline" "$unit" cells)
+    base_depth=$(field "$baseline" "$unit" depth)
+    line=$(awk -v u="$unit" -v c="$cells" -v bc="$base_cells" -v d="$depth" -v bd="$base_depth" -v tol="$tolerance" 'BEGIN {
+        if (bc == "" || bd == "") { printf "%-16s %10d %10s %8s %8d %8s %8s  new\n", u, c, "-", "-", d, "-", "-"; exit 0 }
+        cc = bc ? 100 * (c - bc) / bc : 0
+        dc = bd ? 100 * (d - bd) / bd : 0
+        worse = (cc > tol ? " area" : "") (dc > tol ? " depth" : "")
+        printf "%-16s %10d %10d %7.1f%% %8d %8d %7.1f%%%s\n", u, c, bc, cc, d, bd, dc, worse ? "  WORSE:" worse : ""
+        exit worse ? 1 : 0
+    }') || status=1
+    echo "$line"
+done
+[ $status -ne 0 ] && echo "Area or logic depth grew by more than $tolerance% against $baseline."
+exit $status
@@ -3,13 +3,33 @@
 #include <cstdint>
 #include <cmath>
 #include <iomanip>
+#include <string>
+#include <deque>
+#include <set>
+#include <cstdlib>
 
-// Verilator header
+// Verilator header (tracing support follows make TRACE=off|vcd|fst)
 #include "verilated.h"
+#ifndef VM_TRACE
+#define VM_TRACE 0
+#endif
+#if VM_TRACE_FST
+#include "verilated_fst_c.h"
+typedef VerilatedFstC TraceFile;
+const char* const TRACE_EXT = ".fst";
+#elif VM_TRACE
 #include "verilated_vcd_c.h"
+typedef VerilatedVcdC TraceFile;
+const char* const TRACE_EXT = ".vcd";
+#else
+struct TraceFile;   // built without trace code, nothing is ever dumped
+#endif
 
 // FPU Top module header
 #include "VFPU_Top.h"
+#include "fpu_opcodes.h"
+#include "fpu_trace.h"
+#include "fpu_cov.h"
 
 // helper function
 uint32_t i32_to_u32(int32_t i) {
@@ -38,43 +58,22 @@ double u64_to_f64(uint64_t u) {
     union { uint64_t u; double d; } converter = {u};
     return converter.d;
 }
-
-// --- Opcode Definitions (Must match FPU_Top.v) ---
-// func7
-const uint8_t OP_FADD_S  = 0b0000000, OP_FADD_D  = 0b0000001;
-const uint8_t OP_FSUB_S  = 0b0000100, OP_FSUB_D  = 0b0000101;
-const uint8_t OP_FMUL_S  = 0b0001000, OP_FMUL_D  = 0b0001001;
-const uint8_t OP_FDIV_S  = 0b0001100, OP_FDIV_D  = 0b0001101;
-const uint8_t OP_FSQRT_S = 0b0101100, OP_FSQRT_D = 0b0101101;
-const uint8_t OP_FCMP_S  = 0b1010000, OP_FCMP_D  = 0b1010001;
-
-const uint8_t OP_FCVT_D_S  = 0b0100001;
-const uint8_t OP_FCVT_W_S  = 0b1100000;
-const uint8_t OP_FCVT_D_W  = 0b1101001;
-
-const uint8_t OP_FCVT_S_D  = 0b0100000;
-const uint8_t OP_FCVT_W_D  = 0b1100001;
-const uint8_t OP_FCVT_S_W  = 0b1101000;
-
-// func3
-const uint8_t CMP_EQ = 0b010;
-const uint8_t CMP_LT = 0b001;
-const uint8_t CMP_LE = 0b000;
-
-const uint8_t RNE = 0b000;
-const uint8_t RTZ = 0b001;
-const uint8_t RDN = 0b010;
-const uint8_t RUP = 0b011;
-const uint8_t RMM = 0b100;
-
-// rs2
-const uint8_t CVT_NN = 0b00000;
-const uint8_t CVT_W  = 0b00000;
-const uint8_t CVT_WU = 0b00001;
+uint64_t pack_x2(uint32_t hi, uint32_t lo) {
+    return ((uint64_t)hi << 32) | lo;
+}
+int lanes(uint8_t hi, uint8_t lo) {
+    return (hi << 5) | lo;
+}
+uint64_t pack_x4(uint16_t l3, uint16_t l2, uint16_t l1, uint16_t l0) {
+    return ((uint64_t)l3 << 48) | ((uint64_t)l2 << 32) | ((uint64_t)l1 << 16) | l0;
+}
+int lanes(uint8_t l3, uint8_t l2, uint8_t l1, uint8_t l0) {
+    return (l3 << 15) | (l2 << 10) | (l1 << 5) | l0;
+}
 
 // --- Test Case Result Type ---
 enum ResultType {
-    FP32, FP64, INT, UINT
+    FP32, FP64, INT, UINT, X2
 };
 
 // define testcase
@@ -94,6 +93,10 @@ struct TestCase {
     bool     expected_overflow;
     bool     expected_underflow;
     bool     expected_inexact;
+
+    uint64_t operand_c = 0;     // FMA addend, unused by the other ops
+    int      expected_lanes = -1;   // packed ops: flag_lanes {lane 3, ..., lane 0}, each {NV, DZ, OF, UF, NX}
+    bool     ftz = false;           // flush-to-zero / denormals-are-zero mode
 };
 
 // simulate clock
@@ -102,26 +105,195 @@ double sc_time_stamp() {
     return main_time;
 }
 
-// run one testcase
-bool run_test(VFPU_Top* top, VerilatedVcdC* tfp, const TestCase& test) {
-    // setting inputs
-    top->func7 = test.func7;
-    top->func3 = test.func3;
-    top->rs2 = test.rs2;
-    top->operand_a = test.operand_a;
-    top->operand_b = test.operand_b;
+// --- Pipeline Configuration (Must match FPU_Top.v) ---
+const int TAG_WIDTH = 8;
+const int NUM_TAGS = 1 << TAG_WIDTH;
+const int NUM_UNITS = 19;           // execute registers sharing the result port
+const int DRAIN_TIMEOUT = 1000;
+
+// --- Tracing (--trace off | all | window:FROM-TO | fail, --trace-ring N) ---
+enum TraceMode {
+    TRACE_OFF,
+    TRACE_ALL,          // every cycle to waveform.vcd / .fst
+    TRACE_WINDOW,       // only cycles FROM..TO
+    TRACE_FAIL          // keep recent inputs, replay them into waveform_fail_<test> on a failure
+};
+
+TraceMode trace_mode = VM_TRACE ? TRACE_ALL : TRACE_OFF;
+vluint64_t trace_from = 0, trace_to = ~0ull;
+size_t trace_ring = NUM_TAGS;           // ops kept for replay, NUM_TAGS covers everything in flight
+const int MAX_FAIL_TRACES = 10;
+
+// input ports of one cycle, enough to replay the model from reset
+struct CycleInputs {
+    uint8_t  rst_n, in_valid, in_tag, func7, func3, rs2, ftz;
+    uint64_t operand_a, operand_b, operand_c;
+};
+std::deque<CycleInputs> ring;
+size_t ring_ops = 0;
+
+void record_inputs(VFPU_Top* top) {
+    ring.push_back({top->rst_n, top->in_valid, top->in_tag, top->func7, top->func3, top->rs2, top->ftz,
+                    top->operand_a, top->operand_b, top->operand_c});
+    ring_ops += top->in_valid;
+    while (ring_ops > trace_ring) {
+        ring_ops -= ring.front().in_valid;
+        ring.pop_front();
+    }
+}
+
+// advance one clock cycle
+void tick(VFPU_Top* top, TraceFile* tfp) {
+    if (trace_mode == TRACE_FAIL) record_inputs(top);
+    vluint64_t cycle = main_time / 2;
+    bool dump = tfp && cycle >= trace_from && cycle <= trace_to;
 
-    // simulate one clock
     top->clk = 0;
     top->eval();
     main_time++;
-    if (tfp) tfp->dump(main_time);
-    
+#if VM_TRACE
+    if (dump) tfp->dump(main_time);
+#endif
+
     top->clk = 1;
     top->eval();
     main_time++;
-    if (tfp) tfp->dump(main_time);
+#if VM_TRACE
+    if (dump) tfp->dump(main_time);
+#endif
+    (void)dump;
+}
+
+// Replay the recorded cycles into a fresh traced model. The ring starts mid-stream, so ops
+// issued before it are missing from the waveform; the failing op and everything issued after
+// it are always inside.
+void write_failure_trace(size_t test_index) {
+#if VM_TRACE
+    std::string path = "waveform_fail_" + std::to_string(test_index) + TRACE_EXT;
+    VerilatedContext context;
+    context.traceEverOn(true);
+    VFPU_Top replay(&context);
+    TraceFile trace;
+    replay.trace(&trace, 99);
+    trace.open(path.c_str());
+
+    vluint64_t time = 0;
+    auto replay_tick = [&]() {
+        replay.clk = 0;
+        replay.eval();
+        trace.dump(++time);
+        replay.clk = 1;
+        replay.eval();
+        trace.dump(++time);
+    };
+    replay.rst_n = 0;
+    replay.in_valid = 0;
+    replay_tick();
+    for (const CycleInputs& c : ring) {
+        replay.rst_n = c.rst_n;
+        replay.in_valid = c.in_valid;
+        replay.in_tag = c.in_tag;
+        replay.func7 = c.func7;
+        replay.func3 = c.func3;
+        replay.rs2 = c.rs2;
+        replay.ftz = c.ftz;
+        replay.operand_a = c.operand_a;
+        replay.operand_b = c.operand_b;
+        replay.operand_c = c.operand_c;
+        replay_tick();
+    }
+    trace.close();
+    replay.final();
+    std::cout << "    Waveform of the last " << ring.size() << " cycles written to " << path << std::endl;
+#else
+    (void)test_index;
+#endif
+}
+
+// --- Binary Traces (--import-trace / --export-trace, see fpu_trace.h) ---
+std::string import_path, export_path;
 
+// every test becomes a record with its expected values; 32-bit results are zero-extended as
+// on result_out and scalar flags sit in lane 0
+bool export_tests(const std::string& path, const std::vector<TestCase>& tests) {
+    std::vector<TraceRecord> records;
+    for (const TestCase& t : tests) {
+        TraceRecord r = {};
+        r.func7 = t.func7;
+        r.func3 = t.func3;
+        r.rs2 = t.rs2;
+        r.valid = TRACE_EXPECTED | (t.ftz ? TRACE_FTZ : 0);
+        r.flags = (t.expected_invalid << 4) | (t.expected_divbyzero << 3) | (t.expected_overflow << 2) | (t.expected_underflow << 1) | t.expected_inexact;
+        r.flag_lanes = t.expected_lanes >= 0 ? t.expected_lanes : r.flags;
+        r.operand_a = t.operand_a;
+        r.operand_b = t.operand_b;
+        r.operand_c = t.operand_c;
+        r.result = (t.result_type == FP64 || t.result_type == X2) ? t.expected_result : t.expected_result & 0xFFFFFFFF;
+        records.push_back(r);
+    }
+    return write_trace(path, records);
+}
+
+// records with expected values are appended as tests checking all 64 result bits and every lane
+bool import_tests(const std::string& path, std::vector<TestCase>& tests) {
+    std::vector<TraceRecord> records;
+    if (!read_trace(path, records)) return false;
+    size_t skipped = 0;
+    for (size_t i = 0; i < records.size(); i++) {
+        const TraceRecord& r = records[i];
+        if (!(r.valid & TRACE_EXPECTED)) {
+            skipped++;
+            continue;
+        }
+        TestCase t = {"TRACE: " + path + " #" + std::to_string(i), r.func7, r.func3, r.rs2, X2, r.operand_a, r.operand_b, r.result,
+                      (bool)(r.flags & 0x10), (bool)(r.flags & 0x08), (bool)(r.flags & 0x04), (bool)(r.flags & 0x02), (bool)(r.flags & 0x01),
+                      r.operand_c, (int)r.flag_lanes, (r.valid & TRACE_FTZ) != 0};
+        tests.push_back(t);
+    }
+    if (skipped) std::cout << "Skipped " << skipped << " record(s) without expected values in " << path << std::endl;
+    return true;
+}
+
+// --- Functional Coverage (--coverage file, see fpu_cov.h) ---
+std::string coverage_path;
+
+bool parse_args(int argc, char** argv) {
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string opt = argv[i], value = argv[i + 1];
+        if (opt == "--import-trace") {
+            import_path = value;
+        } else if (opt == "--export-trace") {
+            export_path = value;
+        } else if (opt == "--coverage") {
+            coverage_path = value;
+        } else if (opt == "--trace-ring") {
+            trace_ring = std::strtoull(value.c_str(), nullptr, 0);
+        } else if (opt == "--trace") {
+            if (value == "off") trace_mode = TRACE_OFF;
+            else if (value == "all") trace_mode = TRACE_ALL;
+            else if (value == "fail") trace_mode = TRACE_FAIL;
+            else if (value.compare(0, 7, "window:") == 0 && value.find('-') != std::string::npos) {
+                trace_mode = TRACE_WINDOW;
+                trace_from = std::strtoull(value.c_str() + 7, nullptr, 0);
+                trace_to = std::strtoull(value.c_str() + value.find('-') + 1, nullptr, 0);
+            } else {
+                std::cerr << "Unknown trace mode: " << value << std::endl;
+                return false;
+            }
+        } else {
+            std::cerr << "Unknown option: " << opt << std::endl;
+            return false;
+        }
+    }
+    if (!VM_TRACE && trace_mode != TRACE_OFF) {
+        std::cerr << "Built without tracing (make TRACE=off), ignoring --trace" << std::endl;
+        trace_mode = TRACE_OFF;
+    }
+    return true;
+}
+
+// check the result currently on the output port
+bool check_result(VFPU_Top* top, const TestCase& test) {
     // output check
     bool pass = true;
     switch (test.result_type) {
@@ -147,6 +319,14 @@ bool run_test(VFPU_Top* top, VerilatedVcdC* tfp, const TestCase& test) {
             }
             break;
 
+        case X2:
+            if (top->result_out != test.expected_result) {
+                 pass = false;
+                 std::cout << "    \033[31m[FAIL]\033[0m Result mismatch (X2). Got: 0x" << std::hex << std::setfill('0') << std::setw(16) << top->result_out
+                           << ", Expected: 0x" << std::setw(16) << test.expected_result << std::setfill(' ') << std::dec << std::endl;
+            }
+            break;
+
         case FP64:
              if (top->result_out != test.expected_result) {
                  pass = false;
@@ -177,22 +357,118 @@ bool run_test(VFPU_Top* top, VerilatedVcdC* tfp, const TestCase& test) {
         pass = false;
         std::cout << "    \033[31m[FAIL]\033[0m Inexact flag mismatch. Got: " << (int)top->flag_inexact << ", Expected: " << (int)test.expected_inexact << std::endl;
     }
+    if (test.expected_lanes >= 0 && top->flag_lanes != test.expected_lanes) {
+        pass = false;
+        std::cout << "    \033[31m[FAIL]\033[0m Lane flag mismatch. Got: 0x" << std::hex << (int)top->flag_lanes << ", Expected: 0x" << test.expected_lanes << std::dec << std::endl;
+    }
     
     return pass;
 }
 
+// --- Mixed Streams ---
+// Directed tests re-issued back to back in a fixed unit mix, scored by tag as they complete.
+// Reports the sustained issue rate and how many results overtook an older op still in flight.
+struct StreamStats {
+    size_t   ops = 0;
+    size_t   failed = 0;
+    size_t   reordered = 0;
+    uint64_t cycles = 0;        // first issue to last completion
+    std::vector<uint64_t> latency;  // per stream position, cycles from acceptance to result
+};
+
+StreamStats run_stream(VFPU_Top* top, TraceFile* tfp, const std::vector<const TestCase*>& stream) {
+    StreamStats stats;
+    stats.latency.assign(stream.size(), 0);
+    std::vector<uint64_t> accepted_at(stream.size(), 0);
+    std::vector<int64_t> in_flight(NUM_TAGS, -1);  // tag -> position in the stream
+    std::set<int64_t> pending;
+    size_t next = 0;
+    uint32_t next_tag = 0;
+    int idle_cycles = 0;
+    while (stats.ops < stream.size() && idle_cycles < DRAIN_TIMEOUT) {
+        bool issue = (next < stream.size()) && (in_flight[next_tag] < 0);
+        top->in_valid = issue;
+        if (issue) {
+            const TestCase& test = *stream[next];
+            top->in_tag = next_tag;
+            top->func7 = test.func7;
+            top->func3 = test.func3;
+            top->rs2 = test.rs2;
+            top->ftz = test.ftz;
+            top->operand_a = test.operand_a;
+            top->operand_b = test.operand_b;
+            top->operand_c = test.operand_c;
+        }
+        top->eval();
+        bool accepted = issue && top->in_ready;
+
+        tick(top, tfp);
+        stats.cycles++;
+
+        if (accepted) {
+            pending.insert(next);
+            accepted_at[next] = stats.cycles;
+            in_flight[next_tag] = next++;
+            next_tag = (next_tag + 1) % NUM_TAGS;
+        }
+
+        idle_cycles++;
+        if (top->out_valid && in_flight[top->out_tag] >= 0) {
+            int64_t position = in_flight[top->out_tag];
+            in_flight[top->out_tag] = -1;
+            if (position != *pending.begin()) stats.reordered++;
+            pending.erase(position);
+            stats.latency[position] = stats.cycles - accepted_at[position];
+            stats.ops++;
+            idle_cycles = 0;
+            if (!check_result(top, *stream[position])) {
+                std::cout << "    in stream: " << stream[position]->name << std::endl;
+                stats.failed++;
+            }
+        }
+    }
+    top->in_valid = 0;
+    stats.failed += stream.size() - stats.ops;
+    return stats;
+}
+
+// one op from `slow` then `ratio` ops from `fast`, `length` ops in all, drawn from the tests
+// that passed on their own so a failure here points at op interaction
+std::vector<const TestCase*> mix_stream(const std::vector<TestCase>& tests, const std::vector<bool>& passed,
+                                        uint8_t slow, uint8_t fast, int ratio, size_t length) {
+    std::vector<const TestCase*> slow_tests, fast_tests, stream;
+    for (size_t i = 0; i < tests.size(); i++) {
+        if (!passed[i]) continue;
+        if (tests[i].func7 == slow) slow_tests.push_back(&tests[i]);
+        if (tests[i].func7 == fast) fast_tests.push_back(&tests[i]);
+    }
+    if (slow_tests.empty() || fast_tests.empty()) return stream;
+    for (size_t i = 0; i < length; i++) {
+        size_t group = i / (ratio + 1), slot = i % (ratio + 1);
+        stream.push_back(slot == 0 ? slow_tests[group % slow_tests.size()] : fast_tests[(group * ratio + slot - 1) % fast_tests.size()]);
+    }
+    return stream;
+}
+
 int main(int argc, char** argv, char** env) {
     // initialize Verilator
     Verilated::commandArgs(argc, argv);
-    Verilated::traceEverOn(true);
+    if (!parse_args(argc, argv)) return 2;
 
     // initialize FPU
     VFPU_Top* top = new VFPU_Top;
 
-    // initialize vcd
-    VerilatedVcdC* tfp = new VerilatedVcdC;
-    top->trace(tfp, 99);
-    tfp->open("waveform.vcd");
+    // initialize waveform
+    TraceFile* tfp = nullptr;
+#if VM_TRACE
+    if (trace_mode == TRACE_ALL || trace_mode == TRACE_WINDOW) {
+        Verilated::traceEverOn(true);
+        tfp = new TraceFile;
+        top->trace(tfp, 99);
+        tfp->open((std::string("waveform") + TRACE_EXT).c_str());
+    }
+#endif
+    int fail_traces = 0;
 
     // Testcases
     std::vector<TestCase> test_suite = {
@@ -220,9 +496,21 @@ int main(int argc, char** argv, char** env) {
             {"FSUB.S: 0.0 - 5.5",                            OP_FSUB_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(0.0f),                  f32_to_u32(5.5f),                 f32_to_u32(-5.5f),                0,0,0,0,0},
     
             {"FADD.S: Min_Normal + Min_Denormal",            OP_FADD_S,      RNE,       CVT_NN,    FP32,    0x00800000,                        0x00000001,                       0x00800001,                       0,0,0,0,0}, // Result is min normal + 1
-            {"FSUB.S: Min_Normal - Min_Denormal",            OP_FSUB_S,      RNE,       CVT_NN,    FP32,    0x00800000,                        0x00000001,                       0x007FFFFF,                       0,0,0,1,0}, // Result is max denormal
+            {"FSUB.S: Min_Normal - Min_Denormal",            OP_FSUB_S,      RNE,       CVT_NN,    FP32,    0x00800000,                        0x00000001,                       0x007FFFFF,                       0,0,0,0,0}, // Result is max denormal, exact: no UF (IEEE 754 7.5)
     
             {"FADD.S: MAX_FLOAT + MAX_FLOAT -> Overflow",    OP_FADD_S,      RNE,       CVT_NN,    FP32,    0x7F7FFFFF,                        0x7F7FFFFF,                       f32_to_u32(INFINITY),             0,0,1,0,1},
+            {"FADD.S: MAX_FLOAT + MAX_FLOAT (RTZ)",          OP_FADD_S,      RTZ,       CVT_NN,    FP32,    0x7F7FFFFF,                        0x7F7FFFFF,                       0x7F7FFFFF,                       0,0,1,0,1},
+            {"FADD.S: MAX_FLOAT + MAX_FLOAT (RDN)",          OP_FADD_S,      RDN,       CVT_NN,    FP32,    0x7F7FFFFF,                        0x7F7FFFFF,                       0x7F7FFFFF,                       0,0,1,0,1},
+            {"FADD.S: -MAX_FLOAT + -MAX_FLOAT (RUP)",        OP_FADD_S,      RUP,       CVT_NN,    FP32,    0xFF7FFFFF,                        0xFF7FFFFF,                       0xFF7FFFFF,                       0,0,1,0,1},
+            {"FADD.S: -MAX_FLOAT + -MAX_FLOAT (RDN)",        OP_FADD_S,      RDN,       CVT_NN,    FP32,    0xFF7FFFFF,                        0xFF7FFFFF,                       f32_to_u32(-INFINITY),            0,0,1,0,1},
+            {"FSUB.S: 1.0 - (2^25+4) (RDN)",                 OP_FSUB_S,      RDN,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  0x4C000001,                       0xCC000001,                       0,0,0,0,1},
+            {"FSUB.S: 1.0 - (2^25+4) (RUP)",                 OP_FSUB_S,      RUP,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  0x4C000001,                       0xCC000000,                       0,0,0,0,1},
+            {"FSUB.S: 1.5*2^-126 - Denormal",                OP_FSUB_S,      RNE,       CVT_NN,    FP32,    0x00C00000,                        0x00400000,                       0x00800000,                       0,0,0,0,0},
+            {"FSUB.S: 1.5 - 1.5 -> +0",                      OP_FSUB_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(1.5f),                  f32_to_u32(1.5f),                 0x00000000,                       0,0,0,0,0},
+            {"FSUB.S: 1.5 - 1.5 (RDN) -> -0",                OP_FSUB_S,      RDN,       CVT_NN,    FP32,    f32_to_u32(1.5f),                  f32_to_u32(1.5f),                 0x80000000,                       0,0,0,0,0},
+            {"FADD.S: 0.0 + -0.0 -> +0",                     OP_FADD_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(0.0f),                  0x80000000,                       0x00000000,                       0,0,0,0,0},
+            {"FADD.S: 0.0 + -0.0 (RDN) -> -0",               OP_FADD_S,      RDN,       CVT_NN,    FP32,    f32_to_u32(0.0f),                  0x80000000,                       0x80000000,                       0,0,0,0,0},
+            {"FSUB.S: (Min_Normal+1) - Min_Normal",          OP_FSUB_S,      RNE,       CVT_NN,    FP32,    0x00800001,                        0x00800000,                       0x00000001,                       0,0,0,0,0},
         // DP_Adder        
             {"FADD.D: 1.5 + 2.75",                           OP_FADD_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(1.5),                   f64_to_u64(2.75),                 f64_to_u64(4.25),                 0,0,0,0,0},
             {"FADD.D: 123.55 + 0.375",                       OP_FADD_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(123.55),                f64_to_u64(0.375),                f64_to_u64(123.925),              0,0,0,0,0},
@@ -244,9 +532,17 @@ int main(int argc, char** argv, char** env) {
             {"FSUB.D: 0.0 - 5.5",                            OP_FSUB_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(0.0),                   f64_to_u64(5.5),                  f64_to_u64(-5.5),                 0,0,0,0,0},
     
             {"FADD.D: Min_Normal + Min_Denormal",            OP_FADD_D,      RNE,       CVT_NN,    FP64,    0x0010000000000000,                0x0000000000000001,               0x0010000000000001,               0,0,0,0,0}, // Result is min normal + 1
-            {"FSUB.D: Min_Normal - Min_Denormal",            OP_FSUB_D,      RNE,       CVT_NN,    FP64,    0x0010000000000000,                0x0000000000000001,               0x000FFFFFFFFFFFFF,               0,0,0,1,0}, // Result is max denormal
+            {"FSUB.D: Min_Normal - Min_Denormal",            OP_FSUB_D,      RNE,       CVT_NN,    FP64,    0x0010000000000000,                0x0000000000000001,               0x000FFFFFFFFFFFFF,               0,0,0,0,0}, // Result is max denormal, exact: no UF (IEEE 754 7.5)
     
             {"FADD.D: MAX_FLOAT + MAX_FLOAT -> Overflow",    OP_FADD_D,      RNE,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                0x7FEFFFFFFFFFFFFF,               f64_to_u64(INFINITY),             0,0,1,0,1},
+            {"FADD.D: MAX_FLOAT + MAX_FLOAT (RTZ)",          OP_FADD_D,      RTZ,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                0x7FEFFFFFFFFFFFFF,               0x7FEFFFFFFFFFFFFF,               0,0,1,0,1},
+            {"FADD.D: -MAX_FLOAT + -MAX_FLOAT (RUP)",        OP_FADD_D,      RUP,       CVT_NN,    FP64,    0xFFEFFFFFFFFFFFFF,                0xFFEFFFFFFFFFFFFF,               0xFFEFFFFFFFFFFFFF,               0,0,1,0,1},
+            {"FSUB.D: 1.0 - (2^54+4) (RDN)",                 OP_FSUB_D,      RDN,       CVT_NN,    FP64,    f64_to_u64(1.0),                   0x4360000000000001,               0xC360000000000001,               0,0,0,0,1},
+            {"FSUB.D: 1.0 - (2^54+4) (RUP)",                 OP_FSUB_D,      RUP,       CVT_NN,    FP64,    f64_to_u64(1.0),                   0x4360000000000001,               0xC360000000000000,               0,0,0,0,1},
+            {"FSUB.D: 1.5*2^-1022 - Denormal",               OP_FSUB_D,      RNE,       CVT_NN,    FP64,    0x0018000000000000,                0x0008000000000000,               0x0010000000000000,               0,0,0,0,0},
+            {"FSUB.D: 1.0 - 1.0 (RDN) -> -0",                OP_FSUB_D,      RDN,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(1.0),                  0x8000000000000000,               0,0,0,0,0},
+            {"FADD.D: 0.0 + -0.0 (RDN) -> -0",               OP_FADD_D,      RDN,       CVT_NN,    FP64,    f64_to_u64(0.0),                   0x8000000000000000,               0x8000000000000000,               0,0,0,0,0},
+            {"FSUB.D: (Min_Normal+1) - Min_Normal",          OP_FSUB_D,      RNE,       CVT_NN,    FP64,    0x0010000000000001,                0x0010000000000000,               0x0000000000000001,               0,0,0,0,0},
     
         // --- Compare Tests ---    
         // SP_Compare    
@@ -261,6 +557,10 @@ int main(int argc, char** argv, char** env) {
             {"FCMP.S: SNaN = 2.0",                           OP_FCMP_S,      CMP_EQ,    CVT_NN,    INT,     0x7f800001,                        f32_to_u32(2.0f),                 0x0000000000000000,               1,0,0,0,0},
             {"FCMP.S: Normal <= Denormal",                   OP_FCMP_S,      CMP_LE,    CVT_NN,    INT,     0x00800000,                        0x00000001,                       0x0000000000000000,               0,0,0,0,0},
             {"FCMP.S: Denormal <= Normal",                   OP_FCMP_S,      CMP_LE,    CVT_NN,    INT,     0x00000001,                        0x00800000,                       0x0000000000000001,               0,0,0,0,0},
+            {"FCMP.S: 0.0 < Min_Denormal",                   OP_FCMP_S,      CMP_LT,    CVT_NN,    INT,     0x00000000,                        0x00000001,                       0x0000000000000001,               0,0,0,0,0},
+            {"FCMP.S: Min_Denormal < 0.0",                   OP_FCMP_S,      CMP_LT,    CVT_NN,    INT,     0x00000001,                        0x00000000,                       0x0000000000000000,               0,0,0,0,0},
+            {"FCMP.S: -Min_Denormal <= -0.0",                OP_FCMP_S,      CMP_LE,    CVT_NN,    INT,     0x80000001,                        0x80000000,                       0x0000000000000001,               0,0,0,0,0},
+            {"FCMP.S: 2.0 < SNaN, after a non-NaN op",       OP_FCMP_S,      CMP_LT,    CVT_NN,    INT,     f32_to_u32(2.0f),                  0x7FA00000,                       0x0000000000000000,               1,0,0,0,0},
         // DP_Compare
             {"FCMP.D: -2.0 < -1.0",                          OP_FCMP_D,      CMP_LT,    CVT_NN,    INT,     f64_to_u64(-2.0),                  f64_to_u64(-1.0),                 0x0000000000000001,               0,0,0,0,0},
             {"FCMP.D: 2.0 = 2.0",                            OP_FCMP_D,      CMP_EQ,    CVT_NN,    INT,     f64_to_u64(2.0),                   f64_to_u64(2.0),                  0x0000000000000001,               0,0,0,0,0},
@@ -273,6 +573,9 @@ int main(int argc, char** argv, char** env) {
             {"FCMP.D: SNaN = 2.0",                           OP_FCMP_D,      CMP_EQ,    CVT_NN,    INT,     0xfff0000000000001,                f64_to_u64(2.0),                  0x0000000000000000,               1,0,0,0,0},
             {"FCMP.D: Normal <= Denormal",                   OP_FCMP_D,      CMP_LE,    CVT_NN,    INT,     0x0010000000000000,                0x0000000000000001,               0x0000000000000000,               0,0,0,0,0},
             {"FCMP.D: Denormal <= Normal",                   OP_FCMP_D,      CMP_LE,    CVT_NN,    INT,     0x0000000000000001,                0x0010000000000000,               0x0000000000000001,               0,0,0,0,0},
+            {"FCMP.D: 0.0 < Min_Denormal",                   OP_FCMP_D,      CMP_LT,    CVT_NN,    INT,     0x0000000000000000,                0x0000000000000001,               0x0000000000000001,               0,0,0,0,0},
+            {"FCMP.D: -Min_Denormal <= -0.0",                OP_FCMP_D,      CMP_LE,    CVT_NN,    INT,     0x8000000000000001,                0x8000000000000000,               0x0000000000000001,               0,0,0,0,0},
+            {"FCMP.D: 2.0 <= SNaN, after a non-NaN op",      OP_FCMP_D,      CMP_LE,    CVT_NN,    INT,     f64_to_u64(2.0),                   0x7FF4000000000000,               0x0000000000000000,               1,0,0,0,0},
     
         // --- Conversion Tests ---    
         // SP_Convert    
@@ -301,7 +604,7 @@ int main(int argc, char** argv, char** env) {
             {"FCVT.WU.S: float(2.1) -> uint (RTZ)",          OP_FCVT_W_S,    RTZ,       CVT_WU,    UINT,    f32_to_u32(2.1f),                  0,                                2U,                               0,0,0,0,1},
             {"FCVT.WU.S: float(2.1) -> uint (RUP)",          OP_FCVT_W_S,    RUP,       CVT_WU,    UINT,    f32_to_u32(2.1f),                  0,                                3U,                               0,0,0,0,1},
             {"FCVT.WU.S: float(2.1) -> uint (RDN)",          OP_FCVT_W_S,    RDN,       CVT_WU,    UINT,    f32_to_u32(2.1f),                  0,                                2U,                               0,0,0,0,1},
-            {"FCVT.WU.S: float(2.1) -> uint (RMM)",          OP_FCVT_W_S,    RMM,       CVT_WU,    UINT,    f32_to_u32(2.1f),                  0,                                3U,                               0,0,0,0,1},
+            {"FCVT.WU.S: float(2.1) -> uint (RMM)",          OP_FCVT_W_S,    RMM,       CVT_WU,    UINT,    f32_to_u32(2.1f),                  0,                                2U,                               0,0,0,0,1}, // RMM rounds ties away, 2.1 is no tie: 2 (IEEE 754 4.3.1)
     
             {"FCVT.W.S: float(0.0) -> int",                  OP_FCVT_W_S,    RUP,       CVT_W,     INT,     f32_to_u32(0.0f),                  0,                                i32_to_u32(0),                    0,0,0,0,0},
             {"FCVT.W.S: float(0.75) -> int",                 OP_FCVT_W_S,    RUP,       CVT_W,     INT,     f32_to_u32(0.75f),                 0,                                i32_to_u32(1),                    0,0,0,0,1},
@@ -316,12 +619,12 @@ int main(int argc, char** argv, char** env) {
             {"FCVT.W.S: float(2.1) -> int (RTZ)",            OP_FCVT_W_S,    RTZ,       CVT_W,     INT,     f32_to_u32(2.1f),                  0,                                i32_to_u32(2),                    0,0,0,0,1},
             {"FCVT.W.S: float(2.1) -> int (RUP)",            OP_FCVT_W_S,    RUP,       CVT_W,     INT,     f32_to_u32(2.1f),                  0,                                i32_to_u32(3),                    0,0,0,0,1},
             {"FCVT.W.S: float(2.1) -> int (RDN)",            OP_FCVT_W_S,    RDN,       CVT_W,     INT,     f32_to_u32(2.1f),                  0,                                i32_to_u32(2),                    0,0,0,0,1},
-            {"FCVT.W.S: float(2.1) -> int (RMM)",            OP_FCVT_W_S,    RMM,       CVT_W,     INT,     f32_to_u32(2.1f),                  0,                                i32_to_u32(3),                    0,0,0,0,1},
+            {"FCVT.W.S: float(2.1) -> int (RMM)",            OP_FCVT_W_S,    RMM,       CVT_W,     INT,     f32_to_u32(2.1f),                  0,                                i32_to_u32(2),                    0,0,0,0,1}, // RMM rounds ties away, 2.1 is no tie: 2 (IEEE 754 4.3.1)
             {"FCVT.W.S: float(-2.1) -> int (RNE)",           OP_FCVT_W_S,    RNE,       CVT_W,     INT,     f32_to_u32(-2.1f),                 0,                                i32_to_u32(-2),                   0,0,0,0,1},
             {"FCVT.W.S: float(-2.1) -> int (RTZ)",           OP_FCVT_W_S,    RTZ,       CVT_W,     INT,     f32_to_u32(-2.1f),                 0,                                i32_to_u32(-2),                   0,0,0,0,1},
             {"FCVT.W.S: float(-2.1) -> int (RUP)",           OP_FCVT_W_S,    RUP,       CVT_W,     INT,     f32_to_u32(-2.1f),                 0,                                i32_to_u32(-2),                   0,0,0,0,1},
             {"FCVT.W.S: float(-2.1) -> int (RDN)",           OP_FCVT_W_S,    RDN,       CVT_W,     INT,     f32_to_u32(-2.1f),                 0,                                i32_to_u32(-3),                   0,0,0,0,1},
-            {"FCVT.W.S: float(-2.1) -> int (RMM)",           OP_FCVT_W_S,    RMM,       CVT_W,     INT,     f32_to_u32(-2.1f),                 0,                                i32_to_u32(-3),                   0,0,0,0,1},
+            {"FCVT.W.S: float(-2.1) -> int (RMM)",           OP_FCVT_W_S,    RMM,       CVT_W,     INT,     f32_to_u32(-2.1f),                 0,                                i32_to_u32(-2),                   0,0,0,0,1}, // RMM rounds ties away, -2.1 is no tie: -2 (IEEE 754 4.3.1)
     
             {"FCVT.D.W: int(0) -> double",                   OP_FCVT_D_W,    RNE,       CVT_W,     FP64,    i32_to_u32(0),                     0,                                f64_to_u64(0.0),                  0,0,0,0,0},
             {"FCVT.D.W: int(3) -> double",                   OP_FCVT_D_W,    RNE,       CVT_W,     FP64,    i32_to_u32(3),                     0,                                f64_to_u64(3.0),                  0,0,0,0,0},
@@ -333,6 +636,14 @@ int main(int argc, char** argv, char** env) {
             {"FCVT.D.WU: uint(3) -> double",                 OP_FCVT_D_W,    RNE,       CVT_WU,    FP64,    3U,                                0,                                f64_to_u64(3.0),                  0,0,0,0,0},
             {"FCVT.D.WU: uint(2147483647) -> double",        OP_FCVT_D_W,    RNE,       CVT_WU,    FP64,    2147483647U,                       0,                                f64_to_u64(2147483647.0),         0,0,0,0,0},
             {"FCVT.D.WU: uint(4294967295) -> double",        OP_FCVT_D_W,    RNE,       CVT_WU,    FP64,    4294967295U,                       0,                                f64_to_u64(4294967295.0),         0,0,0,0,0},
+            {"FCVT.W.S: float(-2.5) -> int (RNE)",           OP_FCVT_W_S,    RNE,       CVT_W,     INT,     f32_to_u32(-2.5f),                 0,                                i32_to_u32(-2),                   0,0,0,0,1},
+            {"FCVT.W.S: float(-2.5) -> int (RMM)",           OP_FCVT_W_S,    RMM,       CVT_W,     INT,     f32_to_u32(-2.5f),                 0,                                i32_to_u32(-3),                   0,0,0,0,1},
+            {"FCVT.W.S: float(2^22 + 0.5) -> int (RNE)",     OP_FCVT_W_S,    RNE,       CVT_W,     INT,     0x4A800001,                        0,                                i32_to_u32(4194304),              0,0,0,0,1},
+            {"FCVT.W.S: float(2^22 + 0.5) -> int (RUP)",     OP_FCVT_W_S,    RUP,       CVT_W,     INT,     0x4A800001,                        0,                                i32_to_u32(4194305),              0,0,0,0,1},
+            {"FCVT.WU.S: float(-0.3) -> uint 0, NX only",    OP_FCVT_W_S,    RNE,       CVT_WU,    UINT,    f32_to_u32(-0.3f),                 0,                                0U,                               0,0,0,0,1},
+            {"FCVT.S.W: int(2^26 + 5) -> float, sticky",     OP_FCVT_S_W,    RNE,       CVT_W,     FP32,    i32_to_u32(67108869),              0,                                0x4C800001,                       0,0,0,0,1},
+            {"FCVT.S.W: int(-(2^25 + 5)) -> float (RDN)",    OP_FCVT_S_W,    RDN,       CVT_W,     FP32,    i32_to_u32(-33554437),             0,                                0xCC000002,                       0,0,0,0,1},
+            {"FCVT.S.W: int(-(2^25 + 5)) -> float (RUP)",    OP_FCVT_S_W,    RUP,       CVT_W,     FP32,    i32_to_u32(-33554437),             0,                                0xCC000001,                       0,0,0,0,1},
         // DP_Convert    
             {"FCVT.S.D: NaN -> NaN",                         OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    f64_to_u64(NAN),                   0,                                f32_to_u32(NAN),                  1,0,0,0,0},
             {"FCVT.S.D: Inf -> Inf",                         OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    f64_to_u64(INFINITY),              0,                                f32_to_u32(INFINITY),             0,0,0,0,0},
@@ -350,8 +661,8 @@ int main(int argc, char** argv, char** env) {
             {"FCVT.S.D: double(around -2^127) -> float",     OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0xC7EE000000000000,                0,                                0xff700000,                       0,0,0,0,0},
             {"FCVT.S.D: double(max float) -> float",         OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0x47EFFFFFE0000000,                0,                                0x7f7fffff,                       0,0,0,0,0},
             {"FCVT.S.D: double(min float) -> float",         OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0xC7EFFFFFE0000000,                0,                                0xff7fffff,                       0,0,0,0,0},
-            {"FCVT.S.D: double(2e115) -> Inf",               OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    f64_to_u64(2e115),                 0,                                f32_to_u32(INFINITY),             1,0,1,0,0},
-            {"FCVT.S.D: double(-2e115) -> -Inf",             OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    f64_to_u64(-2e115),                0,                                f32_to_u32(-INFINITY),            1,0,1,0,0},
+            {"FCVT.S.D: double(2e115) -> Inf",               OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    f64_to_u64(2e115),                 0,                                f32_to_u32(INFINITY),             0,0,1,0,1}, // Overflow raises OF and NX, not NV (IEEE 754 7.4)
+            {"FCVT.S.D: double(-2e115) -> -Inf",             OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    f64_to_u64(-2e115),                0,                                f32_to_u32(-INFINITY),            0,0,1,0,1}, // Overflow raises OF and NX, not NV (IEEE 754 7.4)
             {"FCVT.S.D: double(max denormal) -> float",      OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0x3800000000000000,                0,                                0x00400000,                       0,0,0,0,0},
             {"FCVT.S.D: double(min denormal) -> float",      OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0x36A0000000000000,                0,                                0x00000001,                       0,0,0,0,0},
     
@@ -367,7 +678,7 @@ int main(int argc, char** argv, char** env) {
             {"FCVT.WU.D: double(2.1) -> uint (RTZ)",         OP_FCVT_W_D,    RTZ,       CVT_WU,    UINT,    f64_to_u64(2.1),                   0,                                2U,                               0,0,0,0,1},
             {"FCVT.WU.D: double(2.1) -> uint (RUP)",         OP_FCVT_W_D,    RUP,       CVT_WU,    UINT,    f64_to_u64(2.1),                   0,                                3U,                               0,0,0,0,1},
             {"FCVT.WU.D: double(2.1) -> uint (RDN)",         OP_FCVT_W_D,    RDN,       CVT_WU,    UINT,    f64_to_u64(2.1),                   0,                                2U,                               0,0,0,0,1},
-            {"FCVT.WU.D: double(2.1) -> uint (RMM)",         OP_FCVT_W_D,    RMM,       CVT_WU,    UINT,    f64_to_u64(2.1),                   0,                                3U,                               0,0,0,0,1},
+            {"FCVT.WU.D: double(2.1) -> uint (RMM)",         OP_FCVT_W_D,    RMM,       CVT_WU,    UINT,    f64_to_u64(2.1),                   0,                                2U,                               0,0,0,0,1}, // RMM rounds ties away, 2.1 is no tie: 2 (IEEE 754 4.3.1)
     
             {"FCVT.W.D: double(0.0) -> int",                 OP_FCVT_W_D,    RNE,       CVT_W,     INT,     f64_to_u64(0.0),                   0,                                0U,                               0,0,0,0,0},
             {"FCVT.W.D: double(0.75) -> int",                OP_FCVT_W_D,    RUP,       CVT_W,     INT,     f64_to_u64(0.75),                  0,                                1U,                               0,0,0,0,1},
@@ -382,7 +693,7 @@ int main(int argc, char** argv, char** env) {
             {"FCVT.W.D: double(2.1) -> int (RTZ)",           OP_FCVT_W_D,    RTZ,       CVT_W,     INT,     f64_to_u64(2.1),                   0,                                2U,                               0,0,0,0,1},
             {"FCVT.W.D: double(2.1) -> int (RUP)",           OP_FCVT_W_D,    RUP,       CVT_W,     INT,     f64_to_u64(2.1),                   0,                                3U,                               0,0,0,0,1},
             {"FCVT.W.D: double(2.1) -> int (RDN)",           OP_FCVT_W_D,    RDN,       CVT_W,     INT,     f64_to_u64(2.1),                   0,                                2U,                               0,0,0,0,1},
-            {"FCVT.W.D: double(2.1) -> int (RMM)",           OP_FCVT_W_D,    RMM,       CVT_W,     INT,     f64_to_u64(2.1),                   0,                                3U,                               0,0,0,0,1},
+            {"FCVT.W.D: double(2.1) -> int (RMM)",           OP_FCVT_W_D,    RMM,       CVT_W,     INT,     f64_to_u64(2.1),                   0,                                2U,                               0,0,0,0,1}, // RMM rounds ties away, 2.1 is no tie: 2 (IEEE 754 4.3.1)
     
             {"FCVT.S.W: int(0) -> float",                    OP_FCVT_S_W,    RNE,       CVT_W,     FP32,    i32_to_u32(0),                     0,                                f32_to_u32(0.0),                  0,0,0,0,0},
             {"FCVT.S.W: int(3) -> float",                    OP_FCVT_S_W,    RNE,       CVT_W,     FP32,    i32_to_u32(3),                     0,                                f32_to_u32(3.0),                  0,0,0,0,0},
@@ -394,6 +705,15 @@ int main(int argc, char** argv, char** env) {
             {"FCVT.S.WU: uint(3) -> float",                  OP_FCVT_S_W,    RNE,       CVT_WU,    FP32,    3U,                                0,                                f32_to_u32(3.0),                  0,0,0,0,0},
             {"FCVT.S.WU: uint(2147483647) -> float",         OP_FCVT_S_W,    RNE,       CVT_WU,    FP32,    2147483647U,                       0,                                f32_to_u32(2147483648.0),         0,0,0,0,1},
             {"FCVT.S.WU: uint(4294967295) -> float",         OP_FCVT_S_W,    RNE,       CVT_WU,    FP32,    4294967295U,                       0,                                f32_to_u32(4294967296.0),         0,0,0,0,1},
+            {"FCVT.S.D: double(2e115) -> float (RTZ)",       OP_FCVT_S_D,    RTZ,       CVT_NN,    FP32,    f64_to_u64(2e115),                 0,                                0x7F7FFFFF,                       0,0,1,0,1},
+            {"FCVT.S.D: double(-2e115) -> float (RUP)",      OP_FCVT_S_D,    RUP,       CVT_NN,    FP32,    f64_to_u64(-2e115),                0,                                0xFF7FFFFF,                       0,0,1,0,1},
+            {"FCVT.S.D: double(1.5*2^-149 + ulp) -> float",  OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0x36A8000000000001,                0,                                0x00000002,                       0,0,0,1,1},
+            {"FCVT.S.D: rounds to Min_Normal, not tiny",     OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0x380FFFFFF0000000,                0,                                0x00800000,                       0,0,0,0,1},
+            {"FCVT.S.D: double(1 + 2^-26) (RMM)",            OP_FCVT_S_D,    RMM,       CVT_NN,    FP32,    0x3FF0000004000000,                0,                                0x3F800000,                       0,0,0,0,1},
+            {"FCVT.S.D: double(1 + 2^-24) (RMM)",            OP_FCVT_S_D,    RMM,       CVT_NN,    FP32,    0x3FF0000010000000,                0,                                0x3F800001,                       0,0,0,0,1},
+            {"FCVT.W.D: double(2^31 - 0.5) -> int (RNE)",    OP_FCVT_W_D,    RNE,       CVT_W,     INT,     0x41DFFFFFFFE00000,                0,                                0x7FFFFFFFU,                      1,0,1,0,1},
+            {"FCVT.W.D: double(2^31 - 0.5) -> int (RTZ)",    OP_FCVT_W_D,    RTZ,       CVT_W,     INT,     0x41DFFFFFFFE00000,                0,                                0x7FFFFFFFU,                      0,0,0,0,1},
+            {"FCVT.WU.D: double(2^32 - 0.5) -> uint (RNE)",  OP_FCVT_W_D,    RNE,       CVT_WU,    UINT,    0x41EFFFFFFFF00000,                0,                                0xFFFFFFFFU,                      1,0,1,0,1},
     
         // --- Multiplication Tests ---    
         // SP_Multiplier    
@@ -421,6 +741,21 @@ int main(int argc, char** argv, char** env) {
             {"FMUL.S: 0.3333333 * 0.3 (RUP)",                OP_FMUL_S,      RUP,       CVT_NN,    FP32,    f32_to_u32(0.3333333f),            f32_to_u32(0.3f),                 0x3dcccccd,                       0,0,0,0,1},
             {"FMUL.S: 0.3333333 * 0.3 (RDN)",                OP_FMUL_S,      RDN,       CVT_NN,    FP32,    f32_to_u32(0.3333333f),            f32_to_u32(0.3f),                 0x3dcccccc,                       0,0,0,0,1},
             {"FMUL.S: 0.3333333 * 0.3 (RMM)",                OP_FMUL_S,      RMM,       CVT_NN,    FP32,    f32_to_u32(0.3333333f),            f32_to_u32(0.3f),                 0x3dcccccd,                       0,0,0,0,1},
+            {"FMUL.S: (1+ulp)^2, sticky only in low half",   OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x3F800001,                        0x3F800001,                       0x3F800002,                       0,0,0,0,1},
+            {"FMUL.S: Max mantissa squared",                 OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x3FFFFFFF,                        0x3FFFFFFF,                       0x407FFFFE,                       0,0,0,0,1},
+            {"FMUL.S: Denormal, shifted-out bits in sticky", OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x00800001,                        0x3E800001,                       0x00200001,                       0,0,0,1,1},
+            {"FMUL.S: 1.1 * -1.1 (RDN)",                     OP_FMUL_S,      RDN,       CVT_NN,    FP32,    0x3F8CCCCD,                        0xBF8CCCCD,                       0xBF9AE149,                       0,0,0,0,1},
+            {"FMUL.S: 1.1 * -1.1 (RUP)",                     OP_FMUL_S,      RUP,       CVT_NN,    FP32,    0x3F8CCCCD,                        0xBF8CCCCD,                       0xBF9AE148,                       0,0,0,0,1},
+            {"FMUL.S: (1+ulp)^2, guard 0 (RMM)",             OP_FMUL_S,      RMM,       CVT_NN,    FP32,    0x3F800001,                        0x3F800001,                       0x3F800002,                       0,0,0,0,1},
+            {"FMUL.S: MAX_FLOAT * 2.0 (RTZ)",                OP_FMUL_S,      RTZ,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(2.0f),                 0x7F7FFFFF,                       0,0,1,0,1},
+            {"FMUL.S: -MAX_FLOAT * 2.0 (RUP)",               OP_FMUL_S,      RUP,       CVT_NN,    FP32,    0xFF7FFFFF,                        f32_to_u32(2.0f),                 0xFF7FFFFF,                       0,0,1,0,1},
+            {"FMUL.S: MAX_FLOAT * (1+ulp), round carry",     OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x7F7FFFFF,                        0x3F800001,                       f32_to_u32(INFINITY),             0,0,1,0,1},
+            {"FMUL.S: 2^-100 * 2^-30 -> exact denormal",     OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x0D800000,                        0x30800000,                       0x00080000,                       0,0,0,0,0},
+            {"FMUL.S: (Min_Normal+1) * 0.5, tie",            OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x00800001,                        f32_to_u32(0.5f),                 0x00400000,                       0,0,0,1,1},
+            {"FMUL.S: tiny rounds to Min_Normal",            OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x00FFFFFF,                        f32_to_u32(0.5f),                 0x00800000,                       0,0,0,1,1},
+            {"FMUL.S: Min_Normal after rounding, not tiny",  OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x00FFFFFF,                        0x3F000001,                       0x00800000,                       0,0,0,0,1},
+            {"FMUL.S: 2^-100 * 2^-100 (RUP)",                OP_FMUL_S,      RUP,       CVT_NN,    FP32,    0x0D800000,                        0x0D800000,                       0x00000001,                       0,0,0,1,1},
+            {"FMUL.S: -NaN * 1.0 -> canonical NaN",          OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0xFFC00000,                        f32_to_u32(1.0f),                 0x7FC00000,                       1,0,0,0,0},
         // DP_Multiplier    
             {"FMUL.D: 0.0 * 2.5",                            OP_FMUL_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(0.0),                   f64_to_u64(2.5),                  f64_to_u64(0.0),                  0,0,0,0,0},
             {"FMUL.D: -0.0 * -0.0",                          OP_FMUL_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(-0.0),                  f64_to_u64(-0.0),                 f64_to_u64(0.0),                  0,0,0,0,0},
@@ -446,6 +781,16 @@ int main(int argc, char** argv, char** env) {
             {"FMUL.D: 0.3333333333333333 * 0.3 (RUP)",       OP_FMUL_D,      RUP,       CVT_NN,    FP64,    f64_to_u64(0.3333333333333333),    f64_to_u64(0.3),                  0x3fb9999999999999,               0,0,0,0,1},
             {"FMUL.D: 0.3333333333333333 * 0.3 (RDN)",       OP_FMUL_D,      RDN,       CVT_NN,    FP64,    f64_to_u64(0.3333333333333333),    f64_to_u64(0.3),                  0x3fb9999999999998,               0,0,0,0,1},
             {"FMUL.D: 0.3333333333333333 * 0.3 (RMM)",       OP_FMUL_D,      RMM,       CVT_NN,    FP64,    f64_to_u64(0.3333333333333333),    f64_to_u64(0.3),                  0x3fb9999999999999,               0,0,0,0,1},
+            {"FMUL.D: (1+ulp)^2, sticky only in low half",   OP_FMUL_D,      RNE,       CVT_NN,    FP64,    0x3FF0000000000001,                0x3FF0000000000001,               0x3FF0000000000002,               0,0,0,0,1},
+            {"FMUL.D: Max mantissa squared",                 OP_FMUL_D,      RNE,       CVT_NN,    FP64,    0x3FFFFFFFFFFFFFFF,                0x3FFFFFFFFFFFFFFF,               0x400FFFFFFFFFFFFE,               0,0,0,0,1},
+            {"FMUL.D: Denormal, shifted-out bits in sticky", OP_FMUL_D,      RNE,       CVT_NN,    FP64,    0x0010000000000001,                0x3FD0000000000001,               0x0004000000000001,               0,0,0,1,1},
+            {"FMUL.D: 1.1 * -1.1 (RDN)",                     OP_FMUL_D,      RDN,       CVT_NN,    FP64,    0x3FF199999999999A,                0xBFF199999999999A,               0xBFF35C28F5C28F5E,               0,0,0,0,1},
+            {"FMUL.D: (1+ulp)^2, guard 0 (RMM)",             OP_FMUL_D,      RMM,       CVT_NN,    FP64,    0x3FF0000000000001,                0x3FF0000000000001,               0x3FF0000000000002,               0,0,0,0,1},
+            {"FMUL.D: MAX_FLOAT * 2.0 (RTZ)",                OP_FMUL_D,      RTZ,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                f64_to_u64(2.0),                  0x7FEFFFFFFFFFFFFF,               0,0,1,0,1},
+            {"FMUL.D: MAX_FLOAT * (1+ulp), round carry",     OP_FMUL_D,      RNE,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                0x3FF0000000000001,               f64_to_u64(INFINITY),             0,0,1,0,1},
+            {"FMUL.D: (Min_Normal+1) * 0.5, tie",            OP_FMUL_D,      RNE,       CVT_NN,    FP64,    0x0010000000000001,                f64_to_u64(0.5),                  0x0008000000000000,               0,0,0,1,1},
+            {"FMUL.D: 2^-511 * 2^-767 (RUP)",                OP_FMUL_D,      RUP,       CVT_NN,    FP64,    0x2000000000000000,                0x1000000000000000,               0x0000000000000001,               0,0,0,1,1},
+            {"FMUL.D: -NaN * 1.0 -> canonical NaN",          OP_FMUL_D,      RNE,       CVT_NN,    FP64,    0xFFF8000000000000,                f64_to_u64(1.0),                  0x7FF8000000000000,               1,0,0,0,0},
         
         // --- Division Tests ---
         // SP_Divider
@@ -464,6 +809,8 @@ int main(int argc, char** argv, char** env) {
             {"FDIV.S: 3.0 / 6.0",                            OP_FDIV_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(3.0f),                  f32_to_u32(6.0f),                 f32_to_u32(0.5f),                 0,0,0,0,0},
             {"FDIV.S: 80875.0 / 125.0",                      OP_FDIV_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(80875.0f),              f32_to_u32(125.0f),               f32_to_u32(647.0f),               0,0,0,0,0},
             {"FDIV.S: 114514.0 / 1919810.0",                 OP_FDIV_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(114514.0f),             f32_to_u32(1919810.0f),           f32_to_u32(0.05964861f),          0,0,0,0,1},
+            {"FDIV.S: 9.0 / 1.5 (exact, early exit)",        OP_FDIV_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(9.0f),                  f32_to_u32(1.5f),                 f32_to_u32(6.0f),                 0,0,0,0,0},
+            {"FDIV.S: -3.0 / 0.125 (power-of-two divisor)",  OP_FDIV_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(-3.0f),                 f32_to_u32(0.125f),               f32_to_u32(-24.0f),               0,0,0,0,0},
 
             {"FDIV.S: min denormal / 0.5",                   OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0x00000001,                        f32_to_u32(0.5f),                 0x00000002,                       0,0,0,0,0},
             {"FDIV.S: min denormal / 2.0 (UF)",              OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0x00000001,                        f32_to_u32(2.0f),                 f32_to_u32(0.0f),                 0,0,0,1,1},
@@ -475,6 +822,16 @@ int main(int argc, char** argv, char** env) {
             {"FDIV.S: 1.0 / 3.0 (RUP)",                      OP_FDIV_S,      RUP,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  f32_to_u32(3.0f),                 0x3eaaaaab,                       0,0,0,0,1},
             {"FDIV.S: 1.0 / 3.0 (RDN)",                      OP_FDIV_S,      RDN,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  f32_to_u32(3.0f),                 0x3eaaaaaa,                       0,0,0,0,1},
             {"FDIV.S: 1.0 / 3.0 (RMM)",                      OP_FDIV_S,      RMM,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  f32_to_u32(3.0f),                 0x3eaaaaab,                       0,0,0,0,1},
+            {"FDIV.S: 1.0 / -3.0 (RDN)",                     OP_FDIV_S,      RDN,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  f32_to_u32(-3.0f),                0xBEAAAAAB,                       0,0,0,0,1},
+            {"FDIV.S: 1.0 / -3.0 (RUP)",                     OP_FDIV_S,      RUP,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  f32_to_u32(-3.0f),                0xBEAAAAAA,                       0,0,0,0,1},
+            {"FDIV.S: MAX_FLOAT / 0.5 (RTZ)",                OP_FDIV_S,      RTZ,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(0.5f),                 0x7F7FFFFF,                       0,0,1,0,1},
+            {"FDIV.S: -MAX_FLOAT / 0.5 (RUP)",               OP_FDIV_S,      RUP,       CVT_NN,    FP32,    0xFF7FFFFF,                        f32_to_u32(0.5f),                 0xFF7FFFFF,                       0,0,1,0,1},
+            {"FDIV.S: Min_Normal / 3.0 -> denormal",         OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0x00800000,                        f32_to_u32(3.0f),                 0x002AAAAB,                       0,0,0,1,1},
+            {"FDIV.S: denormal result, single rounding",     OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0x00CCDA26,                        0x4043B54A,                       0x0042FD81,                       0,0,0,1,1},
+            {"FDIV.S: Min_Denormal / 0.5",                   OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0x00000001,                        f32_to_u32(0.5f),                 0x00000002,                       0,0,0,0,0},
+            {"FDIV.S: Denormal / Denormal",                  OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0x00000002,                        0x00000001,                       f32_to_u32(2.0f),                 0,0,0,0,0},
+            {"FDIV.S: Inf / 0.0 -> Inf, no DZ",              OP_FDIV_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(INFINITY),              f32_to_u32(0.0f),                 f32_to_u32(INFINITY),             0,0,0,0,0},
+            {"FDIV.S: -NaN / 1.0 -> canonical NaN",          OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0xFFC00000,                        f32_to_u32(1.0f),                 0x7FC00000,                       1,0,0,0,0},
         // DP_Divider
             {"FDIV.D: NaN / 0.25",                           OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(NAN),                   f64_to_u64(0.25),                 f64_to_u64(NAN),                  1,0,0,0,0},
             {"FDIV.D: Inf / Inf",                            OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(INFINITY),              f64_to_u64(INFINITY),             f64_to_u64(NAN),                  1,0,0,0,0},
@@ -491,6 +848,8 @@ int main(int argc, char** argv, char** env) {
             {"FDIV.D: 3.0 / 6.0",                            OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(3.0),                   f64_to_u64(6.0),                  f64_to_u64(0.5),                  0,0,0,0,0},
             {"FDIV.D: 80875.0 / 125.0",                      OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(80875.0),               f64_to_u64(125.0),                f64_to_u64(647.0),                0,0,0,0,0},
             {"FDIV.D: 114514.0 / 1919810.0",                 OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(114514.0),              f64_to_u64(1919810.0),            0x3FAE8A4343835946,               0,0,0,0,1},
+            {"FDIV.D: 9.0 / 1.5 (exact, early exit)",        OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(9.0),                   f64_to_u64(1.5),                  f64_to_u64(6.0),                  0,0,0,0,0},
+            {"FDIV.D: -3.0 / 0.125 (power-of-two divisor)",  OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(-3.0),                  f64_to_u64(0.125),                f64_to_u64(-24.0),                0,0,0,0,0},
 
             {"FDIV.D: min denormal / 0.5",                   OP_FDIV_D,      RNE,       CVT_NN,    FP64,    0x0000000000000001,                f64_to_u64(0.5),                  0x0000000000000002,               0,0,0,0,0},
             {"FDIV.D: min denormal / 2.0 (UF)",              OP_FDIV_D,      RNE,       CVT_NN,    FP64,    0x0000000000000001,                f64_to_u64(2.0),                  f64_to_u64(0.0),                  0,0,0,1,1},
@@ -501,39 +860,333 @@ int main(int argc, char** argv, char** env) {
             {"FDIV.D: 1.0 / 3.0 (RTZ)",                      OP_FDIV_D,      RTZ,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(3.0),                  0x3fd5555555555555,               0,0,0,0,1},
             {"FDIV.D: 1.0 / 3.0 (RUP)",                      OP_FDIV_D,      RUP,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(3.0),                  0x3fd5555555555556,               0,0,0,0,1},
             {"FDIV.D: 1.0 / 3.0 (RDN)",                      OP_FDIV_D,      RDN,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(3.0),                  0x3fd5555555555555,               0,0,0,0,1},
-            {"FDIV.D: 1.0 / 3.0 (RMM)",                      OP_FDIV_D,      RMM,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(3.0),                  0x3fd5555555555556,               0,0,0,0,1},
+            {"FDIV.D: 1.0 / 3.0 (RMM)",                      OP_FDIV_D,      RMM,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(3.0),                  0x3fd5555555555555,               0,0,0,0,1}, // Guard bit 0, no tie: rounds down to ...5555 (IEEE 754 4.3.1)
+            {"FDIV.D: 1.0 / -3.0 (RDN)",                     OP_FDIV_D,      RDN,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(-3.0),                 0xBFD5555555555556,               0,0,0,0,1},
+            {"FDIV.D: MAX_FLOAT / 0.5 (RTZ)",                OP_FDIV_D,      RTZ,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                f64_to_u64(0.5),                  0x7FEFFFFFFFFFFFFF,               0,0,1,0,1},
+            {"FDIV.D: Min_Normal / 3.0 -> denormal",         OP_FDIV_D,      RNE,       CVT_NN,    FP64,    0x0010000000000000,                f64_to_u64(3.0),                  0x0005555555555555,               0,0,0,1,1},
+            {"FDIV.D: Denormal / Denormal",                  OP_FDIV_D,      RNE,       CVT_NN,    FP64,    0x0000000000000002,                0x0000000000000001,               f64_to_u64(2.0),                  0,0,0,0,0},
+            {"FDIV.D: Inf / 0.0 -> Inf, no DZ",              OP_FDIV_D,      RNE,       CVT_NN,    FP64,    f64_to_u64(INFINITY),              f64_to_u64(0.0),                  f64_to_u64(INFINITY),             0,0,0,0,0},
+
+        // --- Square Root Tests ---
+            {"FSQRT.S: NaN",                                 OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(NAN),                   f32_to_u32(0.0f),                 f32_to_u32(NAN),                  1,0,0,0,0},
+            {"FSQRT.S: -1.0",                                OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(-1.0f),                 f32_to_u32(0.0f),                 f32_to_u32(NAN),                  1,0,0,0,0},
+            {"FSQRT.S: -Inf",                                OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(-INFINITY),             f32_to_u32(0.0f),                 f32_to_u32(NAN),                  1,0,0,0,0},
+            {"FSQRT.S: -min denormal",                       OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    0x80000001,                        f32_to_u32(0.0f),                 f32_to_u32(NAN),                  1,0,0,0,0},
+            {"FSQRT.S: Inf",                                 OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(INFINITY),              f32_to_u32(0.0f),                 f32_to_u32(INFINITY),             0,0,0,0,0},
+            {"FSQRT.S: 0.0",                                 OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(0.0f),                  f32_to_u32(0.0f),                 f32_to_u32(0.0f),                 0,0,0,0,0},
+            {"FSQRT.S: -0.0",                                OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(-0.0f),                 f32_to_u32(0.0f),                 f32_to_u32(-0.0f),                0,0,0,0,0},
+
+            {"FSQRT.S: 4.0 (exact, early exit)",             OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(4.0f),                  f32_to_u32(0.0f),                 f32_to_u32(2.0f),                 0,0,0,0,0},
+            {"FSQRT.S: 0.25",                                OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(0.25f),                 f32_to_u32(0.0f),                 f32_to_u32(0.5f),                 0,0,0,0,0},
+            {"FSQRT.S: min denormal",                        OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    0x00000001,                        f32_to_u32(0.0f),                 0x1A3504F3,                       0,0,0,0,1},
+            {"FSQRT.S: denormal 0x00400000",                 OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    0x00400000,                        f32_to_u32(0.0f),                 0x1FB504F3,                       0,0,0,0,1},
+            {"FSQRT.S: max normal (RNE)",                    OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(0.0f),                 0x5F7FFFFF,                       0,0,0,0,1},
+            {"FSQRT.S: max normal (RUP, carry)",             OP_FSQRT_S,     RUP,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(0.0f),                 0x5F800000,                       0,0,0,0,1},
+
+            {"FSQRT.S: 2.0 (RNE)",                           OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(2.0f),                  f32_to_u32(0.0f),                 0x3FB504F3,                       0,0,0,0,1},
+            {"FSQRT.S: 2.0 (RTZ)",                           OP_FSQRT_S,     RTZ,       CVT_NN,    FP32,    f32_to_u32(2.0f),                  f32_to_u32(0.0f),                 0x3FB504F3,                       0,0,0,0,1},
+            {"FSQRT.S: 2.0 (RUP)",                           OP_FSQRT_S,     RUP,       CVT_NN,    FP32,    f32_to_u32(2.0f),                  f32_to_u32(0.0f),                 0x3FB504F4,                       0,0,0,0,1},
+            {"FSQRT.S: 2.0 (RDN)",                           OP_FSQRT_S,     RDN,       CVT_NN,    FP32,    f32_to_u32(2.0f),                  f32_to_u32(0.0f),                 0x3FB504F3,                       0,0,0,0,1},
+            {"FSQRT.S: 2.0 (RMM)",                           OP_FSQRT_S,     RMM,       CVT_NN,    FP32,    f32_to_u32(2.0f),                  f32_to_u32(0.0f),                 0x3FB504F3,                       0,0,0,0,1},
+
+            {"FSQRT.D: NaN",                                 OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(NAN),                   f64_to_u64(0.0),                  f64_to_u64(NAN),                  1,0,0,0,0},
+            {"FSQRT.D: -1.0",                                OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(-1.0),                  f64_to_u64(0.0),                  f64_to_u64(NAN),                  1,0,0,0,0},
+            {"FSQRT.D: Inf",                                 OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(INFINITY),              f64_to_u64(0.0),                  f64_to_u64(INFINITY),             0,0,0,0,0},
+            {"FSQRT.D: -0.0",                                OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(-0.0),                  f64_to_u64(0.0),                  f64_to_u64(-0.0),                 0,0,0,0,0},
+
+            {"FSQRT.D: 4.0 (exact, early exit)",             OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(4.0),                   f64_to_u64(0.0),                  f64_to_u64(2.0),                  0,0,0,0,0},
+            {"FSQRT.D: min denormal (exact)",                OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    0x0000000000000001,                f64_to_u64(0.0),                  0x1E60000000000000,               0,0,0,0,0},
+            {"FSQRT.D: denormal 0x0008000000000000",         OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    0x0008000000000000,                f64_to_u64(0.0),                  0x1FF6A09E667F3BCD,               0,0,0,0,1},
+            {"FSQRT.D: max normal (RUP, carry)",             OP_FSQRT_D,     RUP,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                f64_to_u64(0.0),                  0x5FF0000000000000,               0,0,0,0,1},
+
+            {"FSQRT.D: 2.0 (RNE)",                           OP_FSQRT_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(2.0),                   f64_to_u64(0.0),                  0x3FF6A09E667F3BCD,               0,0,0,0,1},
+            {"FSQRT.D: 2.0 (RTZ)",                           OP_FSQRT_D,     RTZ,       CVT_NN,    FP64,    f64_to_u64(2.0),                   f64_to_u64(0.0),                  0x3FF6A09E667F3BCC,               0,0,0,0,1},
+            {"FSQRT.D: 2.0 (RUP)",                           OP_FSQRT_D,     RUP,       CVT_NN,    FP64,    f64_to_u64(2.0),                   f64_to_u64(0.0),                  0x3FF6A09E667F3BCD,               0,0,0,0,1},
+            {"FSQRT.D: 2.0 (RDN)",                           OP_FSQRT_D,     RDN,       CVT_NN,    FP64,    f64_to_u64(2.0),                   f64_to_u64(0.0),                  0x3FF6A09E667F3BCC,               0,0,0,0,1},
+            {"FSQRT.D: 2.0 (RMM)",                           OP_FSQRT_D,     RMM,       CVT_NN,    FP64,    f64_to_u64(2.0),                   f64_to_u64(0.0),                  0x3FF6A09E667F3BCD,               0,0,0,0,1},
+
+        // --- Fused Multiply-Add Tests (operand_c last) ---
+            {"FMADD.S: 1.5 * 2.0 + 0.25",                    OP_FMADD_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(1.5f),                  f32_to_u32(2.0f),                 f32_to_u32(3.25f),                0,0,0,0,0, f32_to_u32(0.25f)},
+            {"FMSUB.S: 1.5 * 2.0 - 0.25",                    OP_FMSUB_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(1.5f),                  f32_to_u32(2.0f),                 f32_to_u32(2.75f),                0,0,0,0,0, f32_to_u32(0.25f)},
+            {"FNMSUB.S: -(1.5 * 2.0) + 0.25",                OP_FNMSUB_S,    RNE,       CVT_NN,    FP32,    f32_to_u32(1.5f),                  f32_to_u32(2.0f),                 f32_to_u32(-2.75f),               0,0,0,0,0, f32_to_u32(0.25f)},
+            {"FNMADD.S: -(1.5 * 2.0) - 0.25",                OP_FNMADD_S,    RNE,       CVT_NN,    FP32,    f32_to_u32(1.5f),                  f32_to_u32(2.0f),                 f32_to_u32(-3.25f),               0,0,0,0,0, f32_to_u32(0.25f)},
+
+            {"FMADD.S: NaN * 1.0 + 1.0",                     OP_FMADD_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(NAN),                   f32_to_u32(1.0f),                 f32_to_u32(NAN),                  1,0,0,0,0, f32_to_u32(1.0f)},
+            {"FMADD.S: Inf * 0.0 + 1.0",                     OP_FMADD_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(INFINITY),              f32_to_u32(0.0f),                 f32_to_u32(NAN),                  1,0,0,0,0, f32_to_u32(1.0f)},
+            {"FMADD.S: Inf * 1.0 + -Inf",                    OP_FMADD_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(INFINITY),              f32_to_u32(1.0f),                 f32_to_u32(NAN),                  1,0,0,0,0, f32_to_u32(-INFINITY)},
+            {"FMADD.S: 2.0 * 3.0 + -Inf",                    OP_FMADD_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(2.0f),                  f32_to_u32(3.0f),                 f32_to_u32(-INFINITY),            0,0,0,0,0, f32_to_u32(-INFINITY)},
+            {"FMADD.S: 0.0 * 5.0 + 3.0",                     OP_FMADD_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(0.0f),                  f32_to_u32(5.0f),                 f32_to_u32(3.0f),                 0,0,0,0,0, f32_to_u32(3.0f)},
+            {"FMADD.S: -0.0 * 5.0 + -0.0",                   OP_FMADD_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(-0.0f),                 f32_to_u32(5.0f),                 f32_to_u32(-0.0f),                0,0,0,0,0, f32_to_u32(-0.0f)},
+            {"FMSUB.S: 1.0 * 1.0 - 1.0 (RNE)",               OP_FMSUB_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  f32_to_u32(1.0f),                 f32_to_u32(0.0f),                 0,0,0,0,0, f32_to_u32(1.0f)},
+            {"FMSUB.S: 1.0 * 1.0 - 1.0 (RDN)",               OP_FMSUB_S,     RDN,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  f32_to_u32(1.0f),                 f32_to_u32(-0.0f),                0,0,0,0,0, f32_to_u32(1.0f)},
+
+            {"FMADD.S: (1+2^-12)^2 - (1+2^-11) (fused)",     OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x3F800800,                        0x3F800800,                       0x33800000,                       0,0,0,0,0, 0xBF801000},
+            {"FMSUB.S: 0.1 * 10.0 - 1.0 (fused)",            OP_FMSUB_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(0.1f),                  f32_to_u32(10.0f),                0x32800000,                       0,0,0,0,0, f32_to_u32(1.0f)},
+            {"FMADD.S: max * 2.0 + -max (fused)",            OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(2.0f),                 0x7F7FFFFF,                       0,0,0,0,0, 0xFF7FFFFF},
+
+            {"FMADD.S: (1+2^-23)(1+3*2^-23) + 1 (RNE)",      OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x3F800001,                        0x3F800003,                       0x40000002,                       0,0,0,0,1, f32_to_u32(1.0f)},
+            {"FMADD.S: (1+2^-23)(1+3*2^-23) + 1 (RTZ)",      OP_FMADD_S,     RTZ,       CVT_NN,    FP32,    0x3F800001,                        0x3F800003,                       0x40000002,                       0,0,0,0,1, f32_to_u32(1.0f)},
+            {"FMADD.S: (1+2^-23)(1+3*2^-23) + 1 (RUP)",      OP_FMADD_S,     RUP,       CVT_NN,    FP32,    0x3F800001,                        0x3F800003,                       0x40000003,                       0,0,0,0,1, f32_to_u32(1.0f)},
+            {"FMADD.S: (1+2^-23)(1+3*2^-23) + 1 (RMM)",      OP_FMADD_S,     RMM,       CVT_NN,    FP32,    0x3F800001,                        0x3F800003,                       0x40000002,                       0,0,0,0,1, f32_to_u32(1.0f)},
+            {"FNMADD.S: -(1+2^-23)(1+3*2^-23) - 1 (RDN)",    OP_FNMADD_S,    RDN,       CVT_NN,    FP32,    0x3F800001,                        0x3F800003,                       0xC0000003,                       0,0,0,0,1, f32_to_u32(1.0f)},
+            {"FNMADD.S: -(1+2^-23)(1+3*2^-23) - 1 (RUP)",    OP_FNMADD_S,    RUP,       CVT_NN,    FP32,    0x3F800001,                        0x3F800003,                       0xC0000002,                       0,0,0,0,1, f32_to_u32(1.0f)},
+            {"FMADD.S: 2^-60 * 1.0 + 1.0 (RNE)",             OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x21800000,                        f32_to_u32(1.0f),                 f32_to_u32(1.0f),                 0,0,0,0,1, f32_to_u32(1.0f)},
+            {"FMADD.S: 2^-60 * 1.0 + 1.0 (RUP)",             OP_FMADD_S,     RUP,       CVT_NN,    FP32,    0x21800000,                        f32_to_u32(1.0f),                 0x3F800001,                       0,0,0,0,1, f32_to_u32(1.0f)},
+
+            {"FMADD.S: max * 2.0 + 0.0 (OF, RNE)",           OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(2.0f),                 f32_to_u32(INFINITY),             0,0,1,0,1, f32_to_u32(0.0f)},
+            {"FMADD.S: max * 2.0 + 0.0 (OF, RTZ)",           OP_FMADD_S,     RTZ,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(2.0f),                 0x7F7FFFFF,                       0,0,1,0,1, f32_to_u32(0.0f)},
+            {"FNMADD.S: -(max * 2.0) - 0.0 (OF, RUP)",       OP_FNMADD_S,    RUP,       CVT_NN,    FP32,    0x7F7FFFFF,                        f32_to_u32(2.0f),                 0xFF7FFFFF,                       0,0,1,0,1, f32_to_u32(0.0f)},
+            {"FMADD.S: (1+2^-23) * 2^-140 + 0.0 (UF, RNE)",  OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x3F800001,                        0x00000200,                       0x00000200,                       0,0,0,1,1, f32_to_u32(0.0f)},
+            {"FMADD.S: (1+2^-23) * 2^-140 + 0.0 (UF, RUP)",  OP_FMADD_S,     RUP,       CVT_NN,    FP32,    0x3F800001,                        0x00000200,                       0x00000201,                       0,0,0,1,1, f32_to_u32(0.0f)},
+            {"FMADD.S: 2^-75 * 2^-75 + min denormal (RNE)",  OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x1A000000,                        0x1A000000,                       0x00000002,                       0,0,0,1,1, 0x00000001},
+            {"FMADD.S: 2^-75 * 2^-75 + min denormal (RTZ)",  OP_FMADD_S,     RTZ,       CVT_NN,    FP32,    0x1A000000,                        0x1A000000,                       0x00000001,                       0,0,0,1,1, 0x00000001},
+            {"FMADD.S: 2^-75 * 2^-75 + min denormal (RMM)",  OP_FMADD_S,     RMM,       CVT_NN,    FP32,    0x1A000000,                        0x1A000000,                       0x00000002,                       0,0,0,1,1, 0x00000001},
+            {"FMSUB.S: 3.0 * 3 denormal - 1 denormal",       OP_FMSUB_S,     RNE,       CVT_NN,    FP32,    f32_to_u32(3.0f),                  0x00000003,                       0x00000008,                       0,0,0,0,0, 0x00000001},
+
+            {"FMADD.D: 1.5 * 2.0 + 0.25",                    OP_FMADD_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(1.5),                   f64_to_u64(2.0),                  f64_to_u64(3.25),                 0,0,0,0,0, f64_to_u64(0.25)},
+            {"FMSUB.D: 1.5 * 2.0 - 0.25",                    OP_FMSUB_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(1.5),                   f64_to_u64(2.0),                  f64_to_u64(2.75),                 0,0,0,0,0, f64_to_u64(0.25)},
+            {"FNMSUB.D: -(1.5 * 2.0) + 0.25",                OP_FNMSUB_D,    RNE,       CVT_NN,    FP64,    f64_to_u64(1.5),                   f64_to_u64(2.0),                  f64_to_u64(-2.75),                0,0,0,0,0, f64_to_u64(0.25)},
+            {"FNMADD.D: -(1.5 * 2.0) - 0.25",                OP_FNMADD_D,    RNE,       CVT_NN,    FP64,    f64_to_u64(1.5),                   f64_to_u64(2.0),                  f64_to_u64(-3.25),                0,0,0,0,0, f64_to_u64(0.25)},
+
+            {"FMADD.D: NaN * 1.0 + 1.0",                     OP_FMADD_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(NAN),                   f64_to_u64(1.0),                  f64_to_u64(NAN),                  1,0,0,0,0, f64_to_u64(1.0)},
+            {"FMADD.D: Inf * 0.0 + 1.0",                     OP_FMADD_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(INFINITY),              f64_to_u64(0.0),                  f64_to_u64(NAN),                  1,0,0,0,0, f64_to_u64(1.0)},
+            {"FMSUB.D: 1.0 * 1.0 - 1.0 (RDN)",               OP_FMSUB_D,     RDN,       CVT_NN,    FP64,    f64_to_u64(1.0),                   f64_to_u64(1.0),                  f64_to_u64(-0.0),                 0,0,0,0,0, f64_to_u64(1.0)},
+
+            {"FMADD.D: (1+2^-25)^2 - (1+2^-24) (fused)",     OP_FMADD_D,     RNE,       CVT_NN,    FP64,    0x3FF0000008000000,                0x3FF0000008000000,               0x3CD0000000000000,               0,0,0,0,0, 0xBFF0000010000000},
+            {"FMSUB.D: 0.1 * 10.0 - 1.0 (fused)",            OP_FMSUB_D,     RNE,       CVT_NN,    FP64,    f64_to_u64(0.1),                   f64_to_u64(10.0),                 0x3C90000000000000,               0,0,0,0,0, f64_to_u64(1.0)},
+            {"FMADD.D: max * 2.0 + -max (fused)",            OP_FMADD_D,     RNE,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                f64_to_u64(2.0),                  0x7FEFFFFFFFFFFFFF,               0,0,0,0,0, 0xFFEFFFFFFFFFFFFF},
+
+            {"FMADD.D: (1+2^-52)(1+3*2^-52) + 1 (RNE)",      OP_FMADD_D,     RNE,       CVT_NN,    FP64,    0x3FF0000000000001,                0x3FF0000000000003,               0x4000000000000002,               0,0,0,0,1, f64_to_u64(1.0)},
+            {"FMADD.D: (1+2^-52)(1+3*2^-52) + 1 (RUP)",      OP_FMADD_D,     RUP,       CVT_NN,    FP64,    0x3FF0000000000001,                0x3FF0000000000003,               0x4000000000000003,               0,0,0,0,1, f64_to_u64(1.0)},
+            {"FNMADD.D: -(1+2^-52)(1+3*2^-52) - 1 (RDN)",    OP_FNMADD_D,    RDN,       CVT_NN,    FP64,    0x3FF0000000000001,                0x3FF0000000000003,               0xC000000000000003,               0,0,0,0,1, f64_to_u64(1.0)},
+
+            {"FMADD.D: max * 2.0 + 0.0 (OF, RNE)",           OP_FMADD_D,     RNE,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                f64_to_u64(2.0),                  f64_to_u64(INFINITY),             0,0,1,0,1, f64_to_u64(0.0)},
+            {"FMADD.D: max * 2.0 + 0.0 (OF, RTZ)",           OP_FMADD_D,     RTZ,       CVT_NN,    FP64,    0x7FEFFFFFFFFFFFFF,                f64_to_u64(2.0),                  0x7FEFFFFFFFFFFFFF,               0,0,1,0,1, f64_to_u64(0.0)},
+            {"FMADD.D: (1+2^-52) * denormal + 0.0 (UF, RNE)", OP_FMADD_D,     RNE,       CVT_NN,    FP64,    0x3FF0000000000001,                0x0000000000004000,               0x0000000000004000,               0,0,0,1,1, f64_to_u64(0.0)},
+            {"FMADD.D: (1+2^-52) * denormal + 0.0 (UF, RUP)", OP_FMADD_D,     RUP,       CVT_NN,    FP64,    0x3FF0000000000001,                0x0000000000004000,               0x0000000000004001,               0,0,0,1,1, f64_to_u64(0.0)},
+
+        // --- Packed FP32x2 Tests (lane 1 in the upper half, flag_lanes last) ---
+            {"FADD.PS: {2.0, 1.5} + {3.0, 0.25}",             OP_FADD_PS,     RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(2.0f), f32_to_u32(1.5f)), pack_x2(f32_to_u32(3.0f), f32_to_u32(0.25f)),pack_x2(f32_to_u32(5.0f), f32_to_u32(1.75f)),0,0,0,0,0, 0, lanes(0b00000, 0b00000)},
+            {"FSUB.PS: {NaN, 3.0} - {1.0, 1.0}",              OP_FSUB_PS,     RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(NAN), f32_to_u32(3.0f)), pack_x2(f32_to_u32(1.0f), f32_to_u32(1.0f)),pack_x2(f32_to_u32(NAN), f32_to_u32(2.0f)),1,0,0,0,0, 0, lanes(0b10000, 0b00000)},
+            {"FADD.PS: {1.0 + 2^-30, max + max}",             OP_FADD_PS,     RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(1.0f), 0x7F7FFFFF), pack_x2(0x30800000, 0x7F7FFFFF),  pack_x2(f32_to_u32(1.0f), f32_to_u32(INFINITY)),0,0,1,0,1, 0, lanes(0b00001, 0b00101)},
+            {"FADD.S: upper halves ignored",                  OP_FADD_S,      RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(NAN), f32_to_u32(1.0f)), pack_x2(f32_to_u32(NAN), f32_to_u32(2.0f)),pack_x2(0, f32_to_u32(3.0f)),     0,0,0,0,0, 0, lanes(0b00000, 0b00000)},
+            {"FMUL.PS: {2.0 * 3.0, Inf * 0.0}",               OP_FMUL_PS,     RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(2.0f), f32_to_u32(INFINITY)), pack_x2(f32_to_u32(3.0f), f32_to_u32(0.0f)),pack_x2(f32_to_u32(6.0f), f32_to_u32(NAN)),1,0,0,0,0, 0, lanes(0b00000, 0b10000)},
+            {"FMUL.PS: {(1+2^-23)^2, 2.0 * 3.0}",             OP_FMUL_PS,     RNE,       CVT_NN,    X2,      pack_x2(0x3F800001, f32_to_u32(2.0f)), pack_x2(0x3F800001, f32_to_u32(3.0f)),pack_x2(0x3F800002, f32_to_u32(6.0f)),0,0,0,0,1, 0, lanes(0b00001, 0b00000)},
+            {"FDIV.PS: {1.0 / 0.0, 6.0 / 3.0}",               OP_FDIV_PS,     RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(1.0f), f32_to_u32(6.0f)), pack_x2(f32_to_u32(0.0f), f32_to_u32(3.0f)),pack_x2(f32_to_u32(INFINITY), f32_to_u32(2.0f)),0,1,0,0,0, 0, lanes(0b01000, 0b00000)},
+            {"FDIV.PS: {1.0 / 3.0, 0.0 / 0.0}",               OP_FDIV_PS,     RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(1.0f), f32_to_u32(0.0f)), pack_x2(f32_to_u32(3.0f), f32_to_u32(0.0f)),pack_x2(0x3EAAAAAB, f32_to_u32(NAN)),1,0,0,0,1, 0, lanes(0b00001, 0b10000)},
+            {"FCMP.PS: {1.0 < 2.0, 3.0 < 2.0}",               OP_FCMP_PS,     CMP_LT,    CVT_NN,    X2,      pack_x2(f32_to_u32(1.0f), f32_to_u32(3.0f)), pack_x2(f32_to_u32(2.0f), f32_to_u32(2.0f)),pack_x2(1, 0),                    0,0,0,0,0, 0, lanes(0b00000, 0b00000)},
+            {"FCMP.PS: {SNaN = 2.0, 2.0 = 2.0}",              OP_FCMP_PS,     CMP_EQ,    CVT_NN,    X2,      pack_x2(0x7f800001, f32_to_u32(2.0f)), pack_x2(f32_to_u32(2.0f), f32_to_u32(2.0f)),pack_x2(0, 1),                    1,0,0,0,0, 0, lanes(0b10000, 0b00000)},
+            {"FCVT.W.PS: {-2.5, 3.0} -> int",                 OP_FCVT_W_PS,   RNE,       CVT_W,     X2,      pack_x2(f32_to_u32(-2.5f), f32_to_u32(3.0f)), 0,                                pack_x2(i32_to_u32(-2), 3),       0,0,0,0,1, 0, lanes(0b00001, 0b00000)},
+            {"FCVT.W.PS: {3.0, NaN} -> int",                  OP_FCVT_W_PS,   RNE,       CVT_W,     X2,      pack_x2(f32_to_u32(3.0f), f32_to_u32(NAN)), 0,                                pack_x2(3, i32_to_u32(INT32_MIN)),1,0,0,0,0, 0, lanes(0b00000, 0b10000)},
+            {"FCVT.PS.W: {-7, 16777217} -> float",            OP_FCVT_PS_W,   RNE,       CVT_W,     X2,      pack_x2(i32_to_u32(-7), 16777217),  0,                                pack_x2(f32_to_u32(-7.0f), 0x4B800000),0,0,0,0,1, 0, lanes(0b00000, 0b00001)},
+
+        // --- Packed FP16/BF16 x4 Tests (lane 3 first, flag_lanes last) ---
+            {"FADD.H4: {max+max, -0.5+0.5, 2.0+0.5, 1.0+1.0}", OP_FADD_H4,     RNE,       CVT_NN,    X2,      pack_x4(0x7BFF, 0xB800, 0x4000, 0x3C00), pack_x4(0x7BFF, 0x3800, 0x3800, 0x3C00), pack_x4(0x7C00, 0x0000, 0x4100, 0x4000),0,0,1,0,1, 0, lanes(0b00101, 0b00000, 0b00000, 0b00000)},
+            {"FSUB.B4: {NaN-1, 1.5-(-0.25), 1.0-1.0, 3.0-1.0}", OP_FSUB_B4,     RNE,       CVT_NN,    X2,      pack_x4(0x7FC0, 0x3FC0, 0x3F80, 0x4040), pack_x4(0x3F80, 0xBE80, 0x3F80, 0x3F80), pack_x4(0x7FC0, 0x3FE0, 0x0000, 0x4000),1,0,0,0,0, 0, lanes(0b10000, 0b00000, 0b00000, 0b00000)},
+            {"FMUL.H4: {(1+2^-10)^2, Inf*0, 1.5*1.5, 2*3}",    OP_FMUL_H4,     RNE,       CVT_NN,    X2,      pack_x4(0x3C01, 0x7C00, 0x3E00, 0x4000), pack_x4(0x3C01, 0x0000, 0x3E00, 0x4200), pack_x4(0x3C02, 0x7E00, 0x4080, 0x4600),1,0,0,0,1, 0, lanes(0b00001, 0b10000, 0b00000, 0b00000)},
+            {"FMUL.B4: {max*2, -2*3, 0.5*0.5, 1*1}",           OP_FMUL_B4,     RNE,       CVT_NN,    X2,      pack_x4(0x7F7F, 0xC000, 0x3F00, 0x3F80), pack_x4(0x4000, 0x4040, 0x3F00, 0x3F80), pack_x4(0x7F80, 0xC0C0, 0x3E80, 0x3F80),0,0,1,0,1, 0, lanes(0b00101, 0b00000, 0b00000, 0b00000)},
+            {"FMADD.H4: {max*2+0, 2*3-6, 0.5*0.5+0.25, (1+2^-10)^2}", OP_FMADD_H4,    RNE,       CVT_NN,    X2,      pack_x4(0x7BFF, 0x4000, 0x3800, 0x3C01), pack_x4(0x4000, 0x4200, 0x3800, 0x3C01), pack_x4(0x7C00, 0x0000, 0x3800, 0x3C02),0,0,1,0,1, pack_x4(0x0000, 0xC600, 0x3400, 0x0000), lanes(0b00101, 0b00000, 0b00000, 0b00001)},
+            {"FNMADD.B4: {-(1*1)-(-1), NaN, -(0.5*0.5)-0.25, -(2*3)-1}", OP_FNMADD_B4,   RNE,       CVT_NN,    X2,      pack_x4(0x3F80, 0x7FC0, 0x3F00, 0x4000), pack_x4(0x3F80, 0x3F80, 0x3F00, 0x4040), pack_x4(0x0000, 0x7FC0, 0xBF00, 0xC0E0),1,0,0,0,0, pack_x4(0xBF80, 0x3F80, 0x3E80, 0x3F80), lanes(0b00000, 0b10000, 0b00000, 0b00000)},
+            {"FCVT.H4.S: {SNaN, 1.5*2^-24, 65520, 1.0}",       OP_FCVT_H4_S,   RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(65520.0f), f32_to_u32(1.0f)), pack_x2(0x7F800001, 0x33C00000), pack_x4(0x7E00, 0x0002, 0x7C00, 0x3C00),1,0,1,1,1, 0, lanes(0b10000, 0b00011, 0b00101, 0b00000)},
+            {"FCVT.B4.S: {-Inf, 1+3*2^-8, 1+2^-8, 3.0}",       OP_FCVT_B4_S,   RNE,       CVT_NN,    X2,      pack_x2(0x3F808000, f32_to_u32(3.0f)), pack_x2(f32_to_u32(-INFINITY), 0x3F818000), pack_x4(0xFF80, 0x3F82, 0x3F80, 0x4040),0,0,0,0,1, 0, lanes(0b00000, 0b00001, 0b00001, 0b00000)},
+            {"FCVT.PS.H4: lanes {3, 2} = {Inf, 2^-24}",        OP_FCVT_PS_H4,  RNE,       1,         X2,      pack_x4(0x7C00, 0x0001, 0x7E00, 0x3C00), 0, pack_x2(f32_to_u32(INFINITY), 0x33800000),0,0,0,0,0, 0, lanes(0b00000, 0b00000)},
+            {"FCVT.PS.B4: lanes {1, 0} = {SNaN, -6.0}",        OP_FCVT_PS_B4,  RNE,       0,         X2,      pack_x4(0x7FC0, 0x7FC0, 0x7F81, 0xC0C0), 0, pack_x2(f32_to_u32(NAN), f32_to_u32(-6.0f)),1,0,0,0,0, 0, lanes(0b10000, 0b00000)},
+            {"FCVT.H4.D: 1/3 -> lane 0",                       OP_FCVT_H4_D,   RNE,       CVT_NN,    X2,      f64_to_u64(1.0 / 3.0), 0, pack_x4(0, 0, 0, 0x3555),0,0,0,0,1, 0, lanes(0b00000, 0b00000, 0b00000, 0b00001)},
+            {"FCVT.B4.D: 1e39 -> lane 0 (OF)",                 OP_FCVT_B4_D,   RNE,       CVT_NN,    X2,      f64_to_u64(1e39), 0, pack_x4(0, 0, 0, 0x7F80),0,0,1,0,1, 0, lanes(0b00000, 0b00000, 0b00000, 0b00101)},
+            {"FCVT.D.H4: lane 2 = -65504",                     OP_FCVT_D_H4,   RNE,       2,         X2,      pack_x4(0x3C00, 0xFBFF, 0x7C00, 0x3C00), 0, f64_to_u64(-65504.0),0,0,0,0,0, 0, lanes(0b00000, 0b00000)},
+            {"FCVT.D.B4: lane 3 = 2^-133",                     OP_FCVT_D_B4,   RNE,       3,         X2,      pack_x4(0x0001, 0x3F80, 0x3F80, 0x3F80), 0, 0x37A0000000000000,0,0,0,0,0, 0, lanes(0b00000, 0b00000)},
+
+        // --- Flush-to-zero / Denormals-are-zero Tests (ftz last) ---
+            {"FADD.S ftz: 1.0 + Min_Denormal",               OP_FADD_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  0x00000001,                       f32_to_u32(1.0f),                 0,0,0,0,0, 0, -1, true},
+            {"FSUB.S ftz: Min_Normal - Min_Denormal",        OP_FSUB_S,      RNE,       CVT_NN,    FP32,    0x00800000,                        0x00000001,                       0x00800000,                       0,0,0,0,0, 0, -1, true},
+            {"FMUL.S ftz: 2^-100 * 2^-30 -> +0",             OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x0D800000,                        0x30800000,                       0x00000000,                       0,0,0,1,1, 0, -1, true},
+            {"FMUL.S ftz: -2^-100 * 2^-30 -> -0",            OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x8D800000,                        0x30800000,                       0x80000000,                       0,0,0,1,1, 0, -1, true},
+            {"FMUL.S ftz: 2^-63 * 2^-63 = Min_Normal",       OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x20000000,                        0x20000000,                       0x00800000,                       0,0,0,0,0, 0, -1, true},
+            {"FMUL.S ftz: (1-2^-24) * Min_Normal -> +0",     OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x3F7FFFFF,                        0x00800000,                       0x00000000,                       0,0,0,1,1, 0, -1, true},
+            {"FMUL.S ftz: Min_Denormal * 8.0",               OP_FMUL_S,      RNE,       CVT_NN,    FP32,    0x00000001,                        f32_to_u32(8.0f),                 0x00000000,                       0,0,0,0,0, 0, -1, true},
+            {"FDIV.S ftz: 1.0 / Min_Denormal -> Inf",        OP_FDIV_S,      RNE,       CVT_NN,    FP32,    f32_to_u32(1.0f),                  0x00000001,                       f32_to_u32(INFINITY),             0,1,0,0,0, 0, -1, true},
+            {"FDIV.S ftz: Min_Denormal / 0.5",               OP_FDIV_S,      RNE,       CVT_NN,    FP32,    0x00000001,                        f32_to_u32(0.5f),                 0x00000000,                       0,0,0,0,0, 0, -1, true},
+            {"FMADD.S ftz: 2^-70 * 2^-70 + 0 -> +0",         OP_FMADD_S,     RNE,       CVT_NN,    FP32,    0x1C800000,                        0x1C800000,                       0x00000000,                       0,0,0,1,1, 0, -1, true},
+            {"FSQRT.S ftz: sqrt(Min_Denormal)",              OP_FSQRT_S,     RNE,       CVT_NN,    FP32,    0x00000001,                        0,                                0x00000000,                       0,0,0,0,0, 0, -1, true},
+            {"FCMP.S ftz: Min_Denormal == -0.0",             OP_FCMP_S,      CMP_EQ,    CVT_NN,    INT,     0x00000001,                        0x80000000,                       0x0000000000000001,               0,0,0,0,0, 0, -1, true},
+            {"FCVT.W.S ftz: -Min_Denormal -> 0",             OP_FCVT_W_S,    RNE,       CVT_W,     INT,     0x80000001,                        0,                                0x0000000000000000,               0,0,0,0,0, 0, -1, true},
+            {"FCVT.D.S ftz: Min_Denormal -> 0.0",            OP_FCVT_D_S,    RNE,       CVT_NN,    FP64,    0x00000001,                        0,                                0x0000000000000000,               0,0,0,0,0, 0, -1, true},
+            {"FCVT.S.D ftz: double(min denormal) -> +0",     OP_FCVT_S_D,    RNE,       CVT_NN,    FP32,    0x36A0000000000000,                0,                                0x00000000,                       0,0,0,1,1, 0, -1, true},
+            {"FSUB.D ftz: Min_Normal - Min_Denormal",        OP_FSUB_D,      RNE,       CVT_NN,    FP64,    0x0010000000000000,                0x0000000000000001,               0x0010000000000000,               0,0,0,0,0, 0, -1, true},
+            {"FMUL.D ftz: 2^-1000 * 2^-30 -> +0",            OP_FMUL_D,      RNE,       CVT_NN,    FP64,    0x0170000000000000,                0x3E10000000000000,               0x0000000000000000,               0,0,0,1,1, 0, -1, true},
+            {"FDIV.D ftz: 2^-1000 / 2^40 -> +0",             OP_FDIV_D,      RNE,       CVT_NN,    FP64,    0x0170000000000000,                0x4270000000000000,               0x0000000000000000,               0,0,0,1,1, 0, -1, true},
+            {"FMUL.PS ftz: {2^-100 * 2^-30, 2.0 * 3.0}",      OP_FMUL_PS,     RNE,       CVT_NN,    X2,      pack_x2(0x0D800000, f32_to_u32(2.0f)), pack_x2(0x30800000, f32_to_u32(3.0f)),pack_x2(0, f32_to_u32(6.0f)),     0,0,0,1,1, 0, lanes(0b00011, 0b00000), true},
+            {"FSUB.H4 ftz: {1-1, 1-1, 1.5*2^-14 - 2^-14, 2^-14 - 2^-15}", OP_FSUB_H4, RNE,  CVT_NN,    X2,      pack_x4(0x3C00, 0x3C00, 0x0600, 0x0400), pack_x4(0x3C00, 0x3C00, 0x0400, 0x0200), pack_x4(0x0000, 0x0000, 0x0000, 0x0400),0,0,0,1,1, 0, lanes(0b00000, 0b00000, 0b00011, 0b00000), true},
+            {"FCVT.H4.S ftz: {2^-20, 1.0, 1.0, 1.0}",         OP_FCVT_H4_S,   RNE,       CVT_NN,    X2,      pack_x2(f32_to_u32(1.0f), f32_to_u32(1.0f)), pack_x2(0x35800000, f32_to_u32(1.0f)), pack_x4(0x0000, 0x3C00, 0x3C00, 0x3C00),0,0,0,1,1, 0, lanes(0b00011, 0b00000, 0b00000, 0b00000), true},
+            {"FMUL.B4 ftz: {2^-100 * 2^-30, Min_Denormal * 1, 1*1, 1*1}", OP_FMUL_B4, RNE,  CVT_NN,    X2,      pack_x4(0x0D80, 0x0001, 0x3F80, 0x3F80), pack_x4(0x3080, 0x3F80, 0x3F80, 0x3F80), pack_x4(0x0000, 0x0000, 0x3F80, 0x3F80),0,0,0,1,1, 0, lanes(0b00011, 0b00000, 0b00000, 0b00000), true},
     };
 
+    if (!import_path.empty() && !import_tests(import_path, test_suite)) {
+        std::cerr << import_path << ": not a readable FPU trace" << std::endl;
+        return 2;
+    }
+    if (!export_path.empty()) {
+        if (!export_tests(export_path, test_suite)) {
+            std::cerr << export_path << ": cannot write" << std::endl;
+            return 2;
+        }
+        std::cout << "Exported " << test_suite.size() << " tests to " << export_path << std::endl;
+    }
+
     // reset
     top->rst_n = 0;
-    top->clk = 0;
-    top->eval();
-    main_time++;
-    if (tfp) tfp->dump(main_time);
-    top->clk = 1;
-    top->eval();
-    main_time++;
-    if (tfp) tfp->dump(main_time);
+    top->in_valid = 0;
+    tick(top, tfp);
     top->rst_n = 1;
 
-    // run tests
+    // run tests: issue one op per cycle, score results by tag as they come out
+    std::vector<int> in_flight(NUM_TAGS, -1);   // tag -> test index
+    size_t next_test = 0;
+    size_t completed = 0;
+    uint32_t next_tag = 0;
+    int idle_cycles = 0;
     int passed_count = 0;
-    for (const auto& test : test_suite) {
-        std::cout << "Running test: " << test.name << " ..." << std::endl;
-        if (run_test(top, tfp, test)) {
-            std::cout << "  \033[32m[PASS]\033[0m" << std::endl;
-            passed_count++;
+    uint64_t run_cycles = 0;
+    size_t reordered = 0;
+    std::set<int> pending;                      // issued, not yet completed
+    std::vector<bool> test_passed(test_suite.size(), false);
+    Coverage coverage;
+    while (completed < test_suite.size() && idle_cycles < DRAIN_TIMEOUT) {
+        // setting inputs
+        bool issue = (next_test < test_suite.size()) && (in_flight[next_tag] < 0);
+        top->in_valid = issue;
+        if (issue) {
+            const TestCase& test = test_suite[next_test];
+            top->in_tag = next_tag;
+            top->func7 = test.func7;
+            top->func3 = test.func3;
+            top->rs2 = test.rs2;
+            top->ftz = test.ftz;
+            top->operand_a = test.operand_a;
+            top->operand_b = test.operand_b;
+            top->operand_c = test.operand_c;
+        }
+        top->eval();
+        bool accepted = issue && top->in_ready;
+
+        tick(top, tfp);
+        run_cycles++;
+
+        if (accepted) {
+            pending.insert(next_test);
+            in_flight[next_tag] = next_test++;
+            next_tag = (next_tag + 1) % NUM_TAGS;
+        }
+
+        // scoreboard
+        idle_cycles++;
+        if (top->out_valid) {
+            int index = in_flight[top->out_tag];
+            if (index < 0) {
+                std::cout << "\033[31m[FAIL]\033[0m Unexpected result for tag " << (int)top->out_tag << std::endl;
+                break;
+            }
+            in_flight[top->out_tag] = -1;
+            if (index != *pending.begin()) reordered++;
+            pending.erase(index);
+            completed++;
+            idle_cycles = 0;
+
+            const TestCase& test = test_suite[index];
+            coverage.add(test.func7, top->cov_out);
+            std::cout << "Running test: " << test.name << " ..." << std::endl;
+            if (check_result(top, test)) {
+                std::cout << "  \033[32m[PASS]\033[0m" << std::endl;
+                passed_count++;
+                test_passed[index] = true;
+            } else if (trace_mode == TRACE_FAIL && fail_traces < MAX_FAIL_TRACES) {
+                write_failure_trace(index);
+                fail_traces++;
+            }
         }
     }
+    if (completed < test_suite.size()) {
+        std::cout << "\033[31m[FAIL]\033[0m " << (test_suite.size() - completed) << " test(s) never completed." << std::endl;
+    }
     
     // Summary
     std::cout << "\n----------------------------------------" << std::endl;
     std::cout << "Test Summary: " << passed_count << " / " << test_suite.size() << " passed." << std::endl;
+    std::cout << "Issued in " << run_cycles - idle_cycles << " cycles (" << std::fixed << std::setprecision(2)
+              << (double)completed / std::max<uint64_t>(1, run_cycles - idle_cycles) << " ops/cycle), "
+              << reordered << " completed ahead of an older op" << std::endl;
     std::cout << "----------------------------------------" << std::endl;
 
+    // Performance counters, non-zero only
+    std::vector<uint64_t> counters = read_perf_counters(top);
+    std::cout << "Performance counters:" << std::endl;
+    for (int i = 0; i < NUM_PERF_COUNTERS; i++) {
+        if (counters[i]) std::cout << "  " << std::left << std::setw(22) << perf_counter_names[i] << std::right << counters[i] << std::endl;
+    }
+
+    // Functional coverage of the directed tests (needs make COVERAGE=1)
+    if (!coverage_path.empty()) {
+        std::cout << "Coverage: " << coverage.reached() << " / " << coverage.bins() << " bins, counts in " << coverage_path << std::endl;
+        if (coverage.reached() == 0) std::cout << "  no bin hit, was the model built with COVERAGE=1?" << std::endl;
+        else coverage.report(std::cout);
+        coverage.write(coverage_path);
+    }
+
+    // Sustained ops/cycle on mixed streams: long-latency ops among single-cycle ones
+    struct { const char* name; std::vector<const TestCase*> ops; } streams[] = {
+        {"fdiv.d + 7 fcmp.s", mix_stream(test_suite, test_passed, OP_FDIV_D, OP_FCMP_S, 7, 4096)},
+        {"fdiv.s + 3 fadd.s", mix_stream(test_suite, test_passed, OP_FDIV_S, OP_FADD_S, 3, 4096)},
+        {"fsqrt.d + 7 fmul.d", mix_stream(test_suite, test_passed, OP_FSQRT_D, OP_FMUL_D, 7, 4096)},
+        {"fsqrt.s + 1 fdiv.s", mix_stream(test_suite, test_passed, OP_FSQRT_S, OP_FDIV_S, 1, 1024)},
+    };
+    size_t stream_failures = 0;
+    std::cout << "Mixed streams:" << std::endl;
+    for (auto& stream : streams) {
+        if (stream.ops.empty()) continue;
+        StreamStats stats = run_stream(top, tfp, stream.ops);
+        stream_failures += stats.failed;
+        std::cout << "  " << std::left << std::setw(22) << stream.name << std::right << std::setw(6) << stats.ops << " ops "
+                  << std::setw(7) << stats.cycles << " cycles " << std::fixed << std::setprecision(2) << std::setw(5)
+                  << (double)stats.ops / std::max<uint64_t>(1, stats.cycles) << " ops/cycle " << std::setw(6) << stats.reordered << " reordered"
+                  << (stats.failed ? "  \033[31m" + std::to_string(stats.failed) + " failed\033[0m" : std::string()) << std::endl;
+    }
+
+    // Result port fairness: a long-latency op among back-to-back single-cycle ops, whose execute
+    // registers hold a result every cycle, must still reach the result port within NUM_UNITS
+    // cycles of its latency when it runs alone
+    const int FAIR_GAP = 63;
+    struct { const char* name; std::vector<const TestCase*> ops; } fair_streams[] = {
+        {"fdiv.d + 63 fadd.s", mix_stream(test_suite, test_passed, OP_FDIV_D, OP_FADD_S, FAIR_GAP, 64 * (FAIR_GAP + 1))},
+        {"fsqrt.s + 63 fadd.d", mix_stream(test_suite, test_passed, OP_FSQRT_S, OP_FADD_D, FAIR_GAP, 64 * (FAIR_GAP + 1))},
+    };
+    std::cout << "Result port fairness:" << std::endl;
+    for (auto& stream : fair_streams) {
+        if (stream.ops.empty()) continue;
+        StreamStats stats = run_stream(top, tfp, stream.ops);
+        stream_failures += stats.failed;
+        uint64_t worst = 0;
+        size_t late = 0;
+        for (size_t i = 0; i < stream.ops.size(); i += FAIR_GAP + 1) {
+            uint64_t alone = run_stream(top, tfp, {stream.ops[i]}).latency[0];
+            worst = std::max(worst, stats.latency[i] - std::min(stats.latency[i], alone));
+            if (stats.latency[i] > alone + NUM_UNITS) {
+                if (late++ == 0) std::cout << "    " << stream.ops[i]->name << ": " << stats.latency[i] << " cycles, " << alone << " alone" << std::endl;
+            }
+        }
+        stream_failures += late;
+        std::cout << "  " << std::left << std::setw(22) << stream.name << std::right << " worst wait " << std::setw(3) << worst
+                  << " cycles (bound " << NUM_UNITS << ")"
+                  << (late ? "  \033[31m" + std::to_string(late) + " late\033[0m" : std::string()) << std::endl;
+    }
+
     // clean up
-    tfp->close();
+#if VM_TRACE
+    if (tfp) {
+        tfp->close();
+        delete tfp;
+    }
+#endif
     delete top;
     
-    return (passed_count == test_suite.size()) ? 0 : 1;
+    return (passed_count == test_suite.size() && stream_failures == 0) ? 0 : 1;
 }
@@ -0,0 +1,356 @@
+#include <iostream>
+#include <sstream>
+#include <iomanip>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstdlib>
+#include <chrono>
+#include <random>
+#include <memory>
+
+// Verilator header
+#include "verilated.h"
+
+#include "fpu_opcodes.h"
+#include "fpu_ref.h"
+#include "fpu_gen.h"
+
+// Unit-level harness: one arithmetic unit Verilated as its own top, driven with random scalar
+// ops and checked against fpu_ref::execute. The generic driver is run_unit<Unit>; the unit is
+// picked at compile time with -DUNIT_<module> and supplies its model type, the op_table entries
+// it implements and how one op is applied to its ports.
+//
+//   obj_unit_<module>/unit_tb [--ops N] [--rm 01234] [--seed S] [--max-failures N]
+//
+// A unit only sees what FPU_Top's decode would hand it, so packed ops (two unit instances) and
+// flush-to-zero (applied around the units) are left to the full-top tests.
+
+// time is kept per VerilatedContext, this is only for runtimes that still ask for it
+double sc_time_stamp() {
+    return 0;
+}
+
+// --- Test Vectors ---
+struct Vector {
+    const OpInfo* op;
+    uint8_t  func3;
+    uint8_t  rs2;
+    uint64_t a, b;
+};
+
+struct Observed {
+    uint64_t result;
+    uint8_t  flags;             // {NV, DZ, OF, UF, NX}
+    bool     done = true;       // multi-cycle units: finished within their cycle bound
+};
+
+// cycles a multi-cycle unit may take beyond its worst-case latency before the op is failed
+const int DONE_MARGIN = 16;
+
+template <typename Model>
+uint8_t unit_flags(const Model* m, bool divbyzero = false) {
+    return (m->flag_invalid << 4) | (divbyzero << 3) | (m->flag_overflow << 2) | (m->flag_underflow << 1) | m->flag_inexact;
+}
+
+// The adder and multiplier of older revisions (make compare) have no clk or hold; for them a
+// tick is a plain eval and there is no hold to release.
+template <typename Model>
+auto clock_edge(Model* m, int) -> decltype(m->clk = 0, void()) {
+    m->clk = 0;
+    m->eval();
+    m->clk = 1;
+    m->eval();
+}
+
+template <typename Model>
+void clock_edge(Model* m, long) {
+    m->eval();
+}
+
+template <typename Model>
+void tick(Model* m) {
+    clock_edge(m, 0);
+}
+
+template <typename Model>
+auto release_hold(Model* m, int) -> decltype(m->hold = 0, void()) {
+    m->hold = 0;
+}
+
+template <typename Model>
+void release_hold(Model*, long) {}
+
+// Convert type encodings (SP_Convert.v / DP_Convert.v)
+const uint8_t FP32 = 0, FP64 = 1, INT32 = 2, UINT32 = 3;
+
+// --- Units ---
+#if defined(UNIT_SP_Adder) || defined(UNIT_DP_Adder)
+#ifndef ADD_STAGES
+#define ADD_STAGES 0
+#endif
+#if defined(UNIT_SP_Adder)
+#include "VSP_Adder.h"
+struct Unit {
+    using Model = VSP_Adder;
+    static constexpr const char* name = "SP_Adder";
+    static std::vector<std::string> ops() { return {"fadd.s", "fsub.s"}; }
+#else
+#include "VDP_Adder.h"
+struct Unit {
+    using Model = VDP_Adder;
+    static constexpr const char* name = "DP_Adder";
+    static std::vector<std::string> ops() { return {"fadd.d", "fsub.d"}; }
+#endif
+    static void reset(Model* m) { release_hold(m, 0); }
+    static Observed run(Model* m, const Vector& v) {
+        m->operand_a = v.a;
+        m->operand_b = v.b;
+        m->is_subtraction = (v.op->func7 >> 2) & 1;
+        m->rounding_mode = v.func3;
+        for (int s = 0; s < ADD_STAGES; s++) tick(m);
+        m->eval();
+        return {m->result, unit_flags(m)};
+    }
+};
+
+#elif defined(UNIT_SP_Multiplier) || defined(UNIT_DP_Multiplier)
+#ifndef MUL_STAGES
+#define MUL_STAGES 0
+#endif
+#if defined(UNIT_SP_Multiplier)
+#include "VSP_Multiplier.h"
+struct Unit {
+    using Model = VSP_Multiplier;
+    static constexpr const char* name = "SP_Multiplier";
+    static std::vector<std::string> ops() { return {"fmul.s"}; }
+#else
+#include "VDP_Multiplier.h"
+struct Unit {
+    using Model = VDP_Multiplier;
+    static constexpr const char* name = "DP_Multiplier";
+    static std::vector<std::string> ops() { return {"fmul.d"}; }
+#endif
+    static void reset(Model* m) { release_hold(m, 0); }
+    static Observed run(Model* m, const Vector& v) {
+        m->operand_a = v.a;
+        m->operand_b = v.b;
+        m->rounding_mode = v.func3;
+        for (int s = 0; s < MUL_STAGES; s++) tick(m);
+        m->eval();
+        return {m->result, unit_flags(m)};
+    }
+};
+
+#elif defined(UNIT_SP_Divider) || defined(UNIT_DP_Divider)
+#ifndef DIV_SRT
+#define DIV_SRT 0
+#endif
+#if defined(UNIT_SP_Divider)
+#include "VSP_Divider.h"
+struct Unit {
+    using Model = VSP_Divider;
+    static constexpr const char* name = "SP_Divider";
+    static constexpr int latency = 13 + DIV_SRT;    // ITERATIONS in SP_Divider.v
+    static std::vector<std::string> ops() { return {"fdiv.s"}; }
+#else
+#include "VDP_Divider.h"
+struct Unit {
+    using Model = VDP_Divider;
+    static constexpr const char* name = "DP_Divider";
+    static constexpr int latency = 28 + DIV_SRT;    // ITERATIONS in DP_Divider.v
+    static std::vector<std::string> ops() { return {"fdiv.d"}; }
+#endif
+    static void reset(Model* m) {
+        m->start = 0;
+        m->rst_n = 0;
+        tick(m);
+        m->rst_n = 1;
+    }
+    static Observed run(Model* m, const Vector& v) {
+        m->operand_a = v.a;
+        m->operand_b = v.b;
+        m->rounding_mode = v.func3;
+        m->start = 1;
+        tick(m);
+        m->start = 0;
+        for (int cycle = 0; !m->done; cycle++) {
+            if (cycle == latency + DONE_MARGIN) return {0, 0, false};
+            tick(m);
+        }
+        return {m->result, unit_flags(m, m->flag_divbyzero)};
+    }
+};
+
+#elif defined(UNIT_SP_Convert) || defined(UNIT_DP_Convert)
+#if defined(UNIT_SP_Convert)
+#include "VSP_Convert.h"
+struct Unit {
+    using Model = VSP_Convert;
+    static constexpr const char* name = "SP_Convert";
+    static std::vector<std::string> ops() { return {"fcvt.d.s", "fcvt.w.s", "fcvt.d.w"}; }
+    static void types(const Vector& v, uint8_t& in, uint8_t& out) {
+        uint8_t integer = (v.rs2 & 1) ? UINT32 : INT32;
+        switch (v.op->func7) {
+            case OP_FCVT_D_S: in = FP32; out = FP64; break;
+            case OP_FCVT_W_S: in = FP32; out = integer; break;
+            default:          in = integer; out = FP64; break;
+        }
+    }
+#else
+#include "VDP_Convert.h"
+struct Unit {
+    using Model = VDP_Convert;
+    static constexpr const char* name = "DP_Convert";
+    static std::vector<std::string> ops() { return {"fcvt.s.d", "fcvt.w.d", "fcvt.s.w"}; }
+    static void types(const Vector& v, uint8_t& in, uint8_t& out) {
+        uint8_t integer = (v.rs2 & 1) ? UINT32 : INT32;
+        switch (v.op->func7) {
+            case OP_FCVT_S_D: in = FP64; out = FP32; break;
+            case OP_FCVT_W_D: in = FP64; out = integer; break;
+            default:          in = integer; out = FP32; break;
+        }
+    }
+#endif
+    static void reset(Model*) {}
+    static Observed run(Model* m, const Vector& v) {
+        uint8_t in, out;
+        types(v, in, out);
+        m->operand_in = v.a;
+        m->input_type = in;
+        m->output_type = out;
+        m->rounding_mode = v.func3;
+        m->eval();
+        return {m->result, unit_flags(m)};
+    }
+};
+
+#elif defined(UNIT_SP_Compare) || defined(UNIT_DP_Compare)
+#if defined(UNIT_SP_Compare)
+#include "VSP_Compare.h"
+struct Unit {
+    using Model = VSP_Compare;
+    static constexpr const char* name = "SP_Compare";
+    static std::vector<std::string> ops() { return {"fcmp.s"}; }
+#else
+#include "VDP_Compare.h"
+struct Unit {
+    using Model = VDP_Compare;
+    static constexpr const char* name = "DP_Compare";
+    static std::vector<std::string> ops() { return {"fcmp.d"}; }
+#endif
+    static void reset(Model*) {}
+    static Observed run(Model* m, const Vector& v) {
+        m->operand_a = v.a;
+        m->operand_b = v.b;
+        m->func3 = v.func3;
+        m->eval();
+        return {m->flag_cmp, (uint8_t)(m->flag_invalid << 4)};
+    }
+};
+
+#else
+#error "build with -DUNIT_<module>, see UNITS in the Makefile"
+#endif
+
+// --- Generic Driver ---
+std::string hex(uint64_t v, int width) {
+    std::ostringstream s;
+    s << "0x" << std::hex << std::setfill('0') << std::setw(width) << v;
+    return s.str();
+}
+
+template <typename U>
+int run_unit(int argc, char** argv) {
+    int64_t ops = 1000000;
+    std::string rounding = "01234";
+    uint64_t seed = 1;
+    uint64_t max_failures = 20;
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string opt = argv[i];
+        if (opt == "--ops") ops = std::strtoll(argv[i + 1], nullptr, 0);
+        else if (opt == "--rm") rounding = argv[i + 1];
+        else if (opt == "--seed") seed = std::strtoull(argv[i + 1], nullptr, 0);
+        else if (opt == "--max-failures") max_failures = std::strtoull(argv[i + 1], nullptr, 0);
+        else {
+            std::cerr << "Unknown option: " << opt << std::endl;
+            return 2;
+        }
+    }
+    std::vector<uint8_t> rounding_modes;
+    for (char ch : rounding) {
+        if (ch < '0' || ch > '4') {
+            std::cerr << "Unknown rounding mode: " << ch << std::endl;
+            return 2;
+        }
+        rounding_modes.push_back(ch - '0');
+    }
+    if (rounding_modes.empty()) rounding_modes.push_back(RNE);
+
+    std::vector<const OpInfo*> unit_ops;
+    for (const std::string& name : U::ops()) {
+        for (const OpInfo& op : op_table) {
+            if (name == op.name) unit_ops.push_back(&op);
+        }
+    }
+
+    std::unique_ptr<VerilatedContext> context(new VerilatedContext);
+    context->commandArgs(argc, argv);
+    std::unique_ptr<typename U::Model> model(new typename U::Model(context.get()));
+    U::reset(model.get());
+
+    // --- Run ---
+    static const uint8_t compares[] = {CMP_LE, CMP_LT, CMP_EQ};
+    std::mt19937_64 rng(seed);
+    std::vector<uint64_t> checked(unit_ops.size(), 0), failed(unit_ops.size(), 0);
+    uint64_t failures = 0;
+
+    auto start = std::chrono::steady_clock::now();
+    for (int64_t n = 0; n < ops; n++) {
+        size_t k = rng() % unit_ops.size();
+        Vector v;
+        v.op = unit_ops[k];
+        v.func3 = v.op->compare ? compares[rng() % 3] : rounding_modes[rng() % rounding_modes.size()];
+        v.rs2 = v.op->max_rs2 ? rng() % (v.op->max_rs2 + 1) : 0;
+        v.a = gen_operand(rng, v.op->format);
+        v.b = gen_operand(rng, v.op->format);
+
+        Observed got = U::run(model.get(), v);
+        fpu_ref::RefResult ref = fpu_ref::execute(v.op->func7, v.func3, v.rs2, v.a, v.b, 0);
+        checked[k]++;
+        if (!got.done) {
+            failed[k]++;
+            if (failures++ < max_failures) {
+                std::cout << "\033[31m[FAIL]\033[0m " << v.op->name << " func3 " << (int)v.func3 << " rs2 " << (int)v.rs2
+                          << " a " << hex(v.a, 16) << " b " << hex(v.b, 16) << "\n    done not raised within " << DONE_MARGIN << " cycles of the worst-case latency" << std::endl;
+            }
+            U::reset(model.get());
+        } else if (got.result != ref.result || got.flags != ref.flags) {
+            failed[k]++;
+            if (failures++ < max_failures) {
+                std::cout << "\033[31m[FAIL]\033[0m " << v.op->name << " func3 " << (int)v.func3 << " rs2 " << (int)v.rs2
+                          << " a " << hex(v.a, 16) << " b " << hex(v.b, 16)
+                          << "\n    got " << hex(got.result, 16) << " flags " << hex(got.flags, 2)
+                          << ", expected " << hex(ref.result, 16) << " flags " << hex(ref.flags, 2) << std::endl;
+            }
+        }
+    }
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    model->final();
+
+    // Summary
+    std::cout << "\n----------------------------------------" << std::endl;
+    std::cout << U::name << ": " << ops << " ops, " << failures << " failures, " << std::fixed << std::setprecision(0)
+              << (seconds > 0 ? ops / seconds : 0.0) << " ops/s" << std::endl;
+    for (size_t k = 0; k < unit_ops.size(); k++) {
+        std::cout << "    " << std::left << std::setw(10) << unit_ops[k]->name << std::right
+                  << std::setw(10) << checked[k] << " checked" << std::setw(8) << failed[k] << " failed" << std::endl;
+    }
+    std::cout << "----------------------------------------" << std::endl;
+
+    return failures == 0 ? 0 : 1;
+}
+
+int main(int argc, char** argv, char** env) {
+    return run_unit<Unit>(argc, argv);
+}